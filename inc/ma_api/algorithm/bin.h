@@ -0,0 +1,252 @@
+#ifndef MA_ALGORITHM_BIN_H
+#define MA_ALGORITHM_BIN_H
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <ma_api/type.h>
+#include <ma_api/traits.h>
+#include <ma_api/function.h>
+
+#include <ma_api/dimension/StridedShape.h>
+#include <ma_api/algorithm/convertCopy.h>
+#include <ma_api/parallel/ThreadPool.h>
+
+namespace ma
+{
+    namespace algorithm
+    {
+        enum class BinMode { sum, mean };
+
+        namespace impl
+        {
+            /**
+             * Integers of 8 and 16 bits are summed on 32 bits while a block
+             * can't overflow it, other integers on 64 bits
+             **/
+            template<typename T, bool Small>
+            using BinAccumulator = conditional_t<
+                !std::is_integral<T>::value, T,
+                conditional_t<Small && sizeof(T) <= 2,
+                    conditional_t<std::is_signed<T>::value, std::int32_t, std::uint32_t>,
+                    conditional_t<std::is_signed<T>::value, std::int64_t, std::uint64_t>
+                >
+            >;
+
+            constexpr SizeT smallBlockLimit = 1 << 16;
+
+            /**
+             * acc[j] += sum of the F elements of block j of a row, compile time
+             * factors for contiguous rows let the loop vectorize
+             **/
+            template<SizeT F, typename Acc, typename T>
+            void addRow(Acc * acc, const T * row, SizeT n) noexcept
+            {
+                for(SizeT j(0); j < n; ++j)
+                {
+                    Acc s(0);
+                    for(SizeT k(0); k < F; ++k)
+                        s += Acc(row[j * F + k]);
+                    acc[j] += s;
+                }
+            }
+
+            template<typename Acc, typename T>
+            void addRow(Acc * acc, const T * row, SizeT n, SizeT factor, SizeT stride) noexcept
+            {
+                if(stride == 1)
+                    switch(factor)
+                    {
+                        case 1 : addRow<1>(acc, row, n); return;
+                        case 2 : addRow<2>(acc, row, n); return;
+                        case 4 : addRow<4>(acc, row, n); return;
+                        case 8 : addRow<8>(acc, row, n); return;
+                    }
+
+                for(SizeT j(0); j < n; ++j)
+                {
+                    Acc s(0);
+                    for(SizeT k(0); k < factor; ++k)
+                        s += Acc(row[(j * factor + k) * stride]);
+                    acc[j] += s;
+                }
+            }
+
+            /**
+             * Integer means are rounded half up. Blocks of a power of two
+             * elements divide with a shift.
+             **/
+            template<typename Acc>
+            void meanRow(Acc * acc, SizeT n, SizeT blockSize, std::true_type) noexcept
+            {
+                Acc half(Acc(blockSize / 2));
+
+                if((blockSize & (blockSize - 1)) == 0)
+                {
+                    int shift(0);
+                    while((SizeT(1) << shift) < blockSize) ++shift;
+
+                    for(SizeT j(0); j < n; ++j)
+                        acc[j] = Acc(acc[j] + half) >> shift;
+                }
+                else
+                    for(SizeT j(0); j < n; ++j)
+                    {
+                        double m(double(acc[j]) / double(blockSize) + 0.5);
+                        Acc q(static_cast<Acc>(m));
+                        acc[j] = (double(q) > m) ? q - 1 : q;
+                    }
+            }
+
+            template<typename Acc>
+            void meanRow(Acc * acc, SizeT n, SizeT blockSize, std::false_type) noexcept
+            {
+                Acc inv(Acc(1) / Acc(blockSize));
+
+                for(SizeT j(0); j < n; ++j)
+                    acc[j] *= inv;
+            }
+
+            template<typename D, typename Acc>
+            void storeRow(D * dst, Acc * acc, SizeT n, BinMode mode, SizeT blockSize) noexcept
+            {
+                if(mode == BinMode::mean)
+                    meanRow(acc, n, blockSize, std::is_integral<Acc>());
+
+                for(SizeT j(0); j < n; ++j)
+                    dst[j] = saturateCast<D>(acc[j]);
+            }
+
+            // One factor per dimension, each of at least one element
+            inline void checkFactors(const VectRange & factors, SizeT ndim)
+            {
+                throwIfMismatch(ma::size(factors), ndim, "ERROR : one binning factor per dimension needed");
+
+                for(SizeT d(0); d < ndim; ++d)
+                    if(factors[d] <= 0)
+                        throw std::invalid_argument("ERROR : binning factors must be greater than 0");
+            }
+
+            /**
+             * Source offsets of the output rows (blocks) and of the source
+             * rows summed in one output row (within), last axis excluded
+             **/
+            struct BinLayout
+            {
+                dimension::StridedShape blocks;
+                dimension::StridedShape within;
+                SizeT length, factor, stride;
+                SizeT blockSize;
+
+                BinLayout(const dimension::StridedShape & shape, const VectRange & factors)
+                {
+                    SizeT ndim(shape.ndim());
+
+                    checkFactors(factors, ndim);
+                    massert(ndim > 0);
+
+                    VectRange extents(shape.shape()), strides(shape.strides());
+                    VectRange outer(ndim - 1), outerStrides(ndim - 1), inner(ndim - 1);
+
+                    blockSize = 1;
+                    for(SizeT d(0); d < ndim; ++d)
+                        blockSize *= factors[d];
+
+                    for(SizeT d(0); d + 1 < ndim; ++d)
+                    {
+                        outer[d] = extents[d] / factors[d];
+                        outerStrides[d] = strides[d] * factors[d];
+                        inner[d] = factors[d];
+                    }
+
+                    blocks = dimension::StridedShape(outer, outerStrides);
+                    within = dimension::StridedShape(inner, VectRange(strides.begin(), strides.end() - 1));
+
+                    length = extents[ndim - 1] / factors[ndim - 1];
+                    factor = factors[ndim - 1];
+                    stride = strides[ndim - 1];
+                }
+            };
+
+            template<typename Acc, typename T, typename D>
+            void binRows(const T * src, D * dst, const BinLayout & layout, BinMode mode, SizeT first, SizeT last)
+            {
+                std::vector<Acc> acc(layout.length);
+
+                for(SizeT r(first); r < last; ++r)
+                {
+                    ma::fill(acc.begin(), acc.end(), Acc(0));
+
+                    const T * block(src + layout.blocks.at(r));
+
+                    for(SizeT w(0); w < layout.within.size(); ++w)
+                        addRow(acc.data(), block + layout.within.at(w), layout.length, layout.factor, layout.stride);
+
+                    storeRow(dst + r * layout.length, acc.data(), layout.length, mode, layout.blockSize);
+                }
+            }
+
+            template<typename T, typename D>
+            void binRange(const T * src, D * dst, const BinLayout & layout, BinMode mode, SizeT first, SizeT last)
+            {
+                if(layout.blockSize <= smallBlockLimit)
+                    binRows<BinAccumulator<T, true>>(src, dst, layout, mode, first, last);
+                else
+                    binRows<BinAccumulator<T, false>>(src, dst, layout, mode, first, last);
+            }
+
+            // Output rows per task of the thread pool
+            constexpr SizeT binGrain = 16;
+        }
+
+        /**
+         * Shape of the result of bin : each extent divided by its factor,
+         * the elements of a last incomplete block are dropped. Factors
+         * lower than 1 throw std::invalid_argument.
+         **/
+        template<typename View>
+        VectRange binShape(const View & src, const VectRange & factors)
+        {
+            VectRange shape(src.shape());
+            impl::checkFactors(factors, ma::size(shape));
+
+            for(SizeT d(0); d < SizeT(shape.size()); ++d)
+                shape[d] /= factors[d];
+
+            return shape;
+        }
+
+        /**
+         * Sum or average of the non overlapping blocks of factors elements of
+         * src, written to the dense buffer dst of binShape(src, factors).
+         * Rows are read in place from src, whatever its strides, and the
+         * output rows are split between the threads of pool. Integers are
+         * summed on a wider type, results saturate to the type of dst.
+         **/
+        template<typename View, typename D>
+        void bin(parallel::ThreadPool & pool, const View & src, const VectRange & factors, D * dst, BinMode mode = BinMode::sum)
+        {
+            impl::BinLayout layout(dimension::stridedShape(src.layout()), factors);
+
+            if(layout.length == 0) return;
+
+            pool.parallelFor(0, layout.blocks.size(), impl::binGrain, [&](SizeT first, SizeT last)
+            {
+                impl::binRange(&*src.ptr(), dst, layout, mode, first, last);
+            });
+        }
+
+        template<typename View, typename D>
+        void bin(const View & src, const VectRange & factors, D * dst, BinMode mode = BinMode::sum)
+        {
+            impl::BinLayout layout(dimension::stridedShape(src.layout()), factors);
+
+            if(layout.length == 0) return;
+
+            impl::binRange(&*src.ptr(), dst, layout, mode, 0, layout.blocks.size());
+        }
+    }
+}
+
+#endif //MA_ALGORITHM_BIN_H
@@ -0,0 +1,362 @@
+#ifndef MA_ALGORITHM_COMPRESS_H
+#define MA_ALGORITHM_COMPRESS_H
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+#include <ma_api/type.h>
+#include <ma_api/traits.h>
+#include <ma_api/function.h>
+
+namespace ma
+{
+    namespace algorithm
+    {
+        namespace impl
+        {
+            inline SizeT popcount(std::uint32_t v) noexcept
+            {
+                v = v - ((v >> 1) & 0x55555555u);
+                v = (v & 0x33333333u) + ((v >> 2) & 0x33333333u);
+                return SizeT((((v + (v >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+            }
+
+            /**
+             * Element by element kernels, used for the tails and for types
+             * without vector version
+             **/
+            template<SizeT Size>
+            struct MaskKernel
+            {
+                template<typename T>
+                static SizeT compress(const T * src, const std::uint8_t * mask, SizeT n, T * dst)
+                {
+                    SizeT count(0);
+
+                    for(SizeT i(0); i < n; ++i)
+                        if(mask[i])
+                            dst[count++] = src[i];
+
+                    return count;
+                }
+
+                template<typename T>
+                static SizeT expand(T * dst, const std::uint8_t * mask, SizeT n, const T * values)
+                {
+                    SizeT count(0);
+
+                    for(SizeT i(0); i < n; ++i)
+                        if(mask[i])
+                            dst[i] = values[count++];
+
+                    return count;
+                }
+            };
+
+        #if defined(__AVX512F__)
+
+            template<>
+            struct MaskKernel<4>
+            {
+                template<typename T>
+                static SizeT compress(const T * src, const std::uint8_t * mask, SizeT n, T * dst)
+                {
+                    SizeT count(0), i(0);
+
+                    for(; i + 16 <= n; i += 16)
+                    {
+                        __mmask16 k(laneMask(mask + i));
+
+                        _mm512_mask_compressstoreu_epi32(dst + count, k, _mm512_loadu_si512(src + i));
+                        count += popcount(k);
+                    }
+
+                    return count + MaskKernel<0>::compress(src + i, mask + i, n - i, dst + count);
+                }
+
+                template<typename T>
+                static SizeT expand(T * dst, const std::uint8_t * mask, SizeT n, const T * values)
+                {
+                    SizeT count(0), i(0);
+
+                    for(; i + 16 <= n; i += 16)
+                    {
+                        __mmask16 k(laneMask(mask + i));
+
+                        __m512i v = _mm512_maskz_expandloadu_epi32(k, values + count);
+                        _mm512_mask_storeu_epi32(dst + i, k, v);
+                        count += popcount(k);
+                    }
+
+                    return count + MaskKernel<0>::expand(dst + i, mask + i, n - i, values + count);
+                }
+
+            private:
+                static __mmask16 laneMask(const std::uint8_t * mask) noexcept
+                {
+                    __m512i m = _mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mask)));
+                    return _mm512_test_epi32_mask(m, m);
+                }
+            };
+
+            template<>
+            struct MaskKernel<8>
+            {
+                template<typename T>
+                static SizeT compress(const T * src, const std::uint8_t * mask, SizeT n, T * dst)
+                {
+                    SizeT count(0), i(0);
+
+                    for(; i + 8 <= n; i += 8)
+                    {
+                        __mmask8 k(laneMask(mask + i));
+
+                        _mm512_mask_compressstoreu_epi64(dst + count, k, _mm512_loadu_si512(src + i));
+                        count += popcount(k);
+                    }
+
+                    return count + MaskKernel<0>::compress(src + i, mask + i, n - i, dst + count);
+                }
+
+                template<typename T>
+                static SizeT expand(T * dst, const std::uint8_t * mask, SizeT n, const T * values)
+                {
+                    SizeT count(0), i(0);
+
+                    for(; i + 8 <= n; i += 8)
+                    {
+                        __mmask8 k(laneMask(mask + i));
+
+                        __m512i v = _mm512_maskz_expandloadu_epi64(k, values + count);
+                        _mm512_mask_storeu_epi64(dst + i, k, v);
+                        count += popcount(k);
+                    }
+
+                    return count + MaskKernel<0>::expand(dst + i, mask + i, n - i, values + count);
+                }
+
+            private:
+                static __mmask8 laneMask(const std::uint8_t * mask) noexcept
+                {
+                    __m512i m = _mm512_cvtepu8_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(mask)));
+                    return _mm512_test_epi64_mask(m, m);
+                }
+            };
+
+        #elif defined(__AVX2__)
+
+            /**
+             * Permutations of 32 bits words for each 8 bits lane mask
+             **/
+            struct MaskLut
+            {
+                alignas(32) std::int32_t compress[256][8];
+                alignas(32) std::int32_t expand[256][8];
+
+                MaskLut() noexcept
+                {
+                    for(int bits(0); bits < 256; ++bits)
+                    {
+                        int packed(0), rank(0);
+
+                        for(int lane(0); lane < 8; ++lane)
+                        {
+                            compress[bits][lane] = 0;
+                            expand[bits][lane] = 0;
+                        }
+
+                        for(int lane(0); lane < 8; ++lane)
+                            if(bits & (1 << lane))
+                            {
+                                compress[bits][packed++] = lane;
+                                expand[bits][lane] = rank++;
+                            }
+                    }
+                }
+
+                static const MaskLut & get() noexcept
+                {
+                    static const MaskLut lut;
+                    return lut;
+                }
+            };
+
+            /**
+             * Elements are handled as 1 or 2 words of 32 bits, 8 words per vector
+             **/
+            template<SizeT Size>
+            struct MaskKernelAvx2
+            {
+                static constexpr SizeT ratio = Size / 4;
+                static constexpr SizeT lanes = 8 / ratio;
+
+                template<typename T>
+                static SizeT compress(const T * src, const std::uint8_t * mask, SizeT n, T * dst)
+                {
+                    const MaskLut & lut(MaskLut::get());
+                    SizeT count(0), i(0);
+
+                    for(; i + lanes <= n; i += lanes)
+                    {
+                        std::uint32_t bits(wordBits(mask + i));
+                        SizeT words(popcount(bits));
+
+                        __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i *>(lut.compress[bits]));
+                        __m256i v = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i)), perm);
+
+                        _mm256_maskstore_epi32(reinterpret_cast<int *>(dst + count), firstWords(words), v);
+                        count += words / ratio;
+                    }
+
+                    return count + MaskKernel<0>::compress(src + i, mask + i, n - i, dst + count);
+                }
+
+                template<typename T>
+                static SizeT expand(T * dst, const std::uint8_t * mask, SizeT n, const T * values)
+                {
+                    const MaskLut & lut(MaskLut::get());
+                    const __m256i wordIds = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+                    SizeT count(0), i(0);
+
+                    for(; i + lanes <= n; i += lanes)
+                    {
+                        std::uint32_t bits(wordBits(mask + i));
+                        SizeT words(popcount(bits));
+
+                        // Only read the values used by this block
+                        __m256i v = _mm256_maskload_epi32(reinterpret_cast<const int *>(values + count), firstWords(words));
+                        __m256i perm = _mm256_load_si256(reinterpret_cast<const __m256i *>(lut.expand[bits]));
+                        __m256i selected = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(int(bits)), wordIds), wordIds);
+
+                        _mm256_maskstore_epi32(reinterpret_cast<int *>(dst + i), selected, _mm256_permutevar8x32_epi32(v, perm));
+                        count += words / ratio;
+                    }
+
+                    return count + MaskKernel<0>::expand(dst + i, mask + i, n - i, values + count);
+                }
+
+            private:
+                static __m256i firstWords(SizeT words) noexcept
+                {
+                    return _mm256_cmpgt_epi32(_mm256_set1_epi32(int(words)), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+                }
+
+                // One bit per word of 32 bits
+                static std::uint32_t wordBits(const std::uint8_t * mask) noexcept
+                {
+                    std::uint32_t bits(0);
+
+                    for(SizeT lane(0); lane < lanes; ++lane)
+                        if(mask[lane])
+                            bits |= ((1u << ratio) - 1) << (lane * ratio);
+
+                    return bits;
+                }
+            };
+
+            template<> struct MaskKernel<4> : MaskKernelAvx2<4> {};
+            template<> struct MaskKernel<8> : MaskKernelAvx2<8> {};
+
+        #endif
+
+            template<typename T>
+            using MaskKernelOf = MaskKernel<std::is_trivially_copyable<T>::value ? SizeT(sizeof(T)) : 0>;
+
+            template<typename Mask>
+            const std::uint8_t * maskPtr(const Mask * mask) noexcept
+            {
+                static_assert(sizeof(Mask) == 1, "Mask elements must be bool or 8 bits integers");
+
+                return reinterpret_cast<const std::uint8_t *>(mask);
+            }
+
+            // Apply fn to each block of elements contiguous in both view and mask
+            template<typename View, typename Mask, typename Fn>
+            void forMaskBlocks(View & view, const Mask & mask, Fn && fn)
+            {
+                SizeT size(sizes(view, mask));
+
+                if(size == 0) return;
+
+                SizeT step((contiguous(view) && contiguous(mask)) ? size : steps(view, mask));
+
+                for(SizeT pos(0); pos < size; pos += step)
+                    fn(&view.val(pos), maskPtr(&mask.val(pos)), step);
+            }
+        }
+
+        /**
+         * Pack the elements of view where mask is true in dst, in row major order.
+         * dst must be large enough to hold them, returns the number of elements written.
+         **/
+        template<typename View, typename Mask>
+        SizeT compress(const View & view, const Mask & mask, typename View::value_type * dst)
+        {
+            using T = typename View::value_type;
+
+            SizeT count(0);
+
+            impl::forMaskBlocks(view, mask, [&](const T * src, const std::uint8_t * m, SizeT n)
+            {
+                count += impl::MaskKernelOf<T>::compress(src, m, n, dst + count);
+            });
+
+            return count;
+        }
+
+        /**
+         * Number of elements selected by mask
+         **/
+        template<typename Mask>
+        SizeT countTrue(const Mask & mask)
+        {
+            SizeT count(0);
+
+            for(SizeT pos(0); pos < ma::size(mask); ++pos)
+                count += (mask.val(pos) != 0);
+
+            return count;
+        }
+
+        /**
+         * Reverse of compress : write the consecutive values to the elements of view
+         * where mask is true, returns the number of values consumed.
+         **/
+        template<typename View, typename Mask>
+        SizeT maskedAssign(View & view, const Mask & mask, const typename View::value_type * values)
+        {
+            using T = typename View::value_type;
+
+            SizeT count(0);
+
+            impl::forMaskBlocks(view, mask, [&](T * dst, const std::uint8_t * m, SizeT n)
+            {
+                count += impl::MaskKernelOf<T>::expand(dst, m, n, values + count);
+            });
+
+            return count;
+        }
+
+        /**
+         * Set value to the elements of view where mask is true
+         **/
+        template<typename View, typename Mask>
+        void maskedFill(View & view, const Mask & mask, const typename View::value_type & value)
+        {
+            using T = typename View::value_type;
+
+            impl::forMaskBlocks(view, mask, [&](T * dst, const std::uint8_t * m, SizeT n)
+            {
+                // Select form rather than branch to let the compiler use blends
+                for(SizeT i(0); i < n; ++i)
+                    dst[i] = m[i] ? value : dst[i];
+            });
+        }
+    }
+}
+
+#endif //MA_ALGORITHM_COMPRESS_H
@@ -0,0 +1,284 @@
+#ifndef MA_ALGORITHM_CONVERT_COPY_H
+#define MA_ALGORITHM_CONVERT_COPY_H
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <ma_api/type.h>
+#include <ma_api/traits.h>
+
+namespace ma
+{
+    namespace algorithm
+    {
+        namespace impl
+        {
+            template<typename T>
+            constexpr bool isNegative(T v, std::true_type) noexcept { return v < 0; }
+
+            template<typename T>
+            constexpr bool isNegative(T, std::false_type) noexcept { return false; }
+
+            template<typename T>
+            constexpr bool isNegative(T v) noexcept { return isNegative(v, std::is_signed<T>()); }
+
+            enum class CastKind { plain, integer, rounding };
+
+            template<typename To, typename From>
+            using CastKindOf = std::integral_constant<CastKind,
+                (!std::is_integral<To>::value || std::is_same<To, bool>::value) ? CastKind::plain :
+                std::is_floating_point<From>::value ? CastKind::rounding :
+                std::is_integral<From>::value ? CastKind::integer : CastKind::plain
+            >;
+
+            template<typename To, typename From>
+            constexpr To castAs(From v, std::integral_constant<CastKind, CastKind::plain>) noexcept
+            {
+                return static_cast<To>(v);
+            }
+
+            template<typename To, typename From>
+            To castAs(From v, std::integral_constant<CastKind, CastKind::integer>) noexcept
+            {
+                using Limits = std::numeric_limits<To>;
+
+                if(isNegative(v))
+                    return (std::intmax_t(v) < std::intmax_t(Limits::min())) ? Limits::min() : To(v);
+
+                return (std::uintmax_t(v) > std::uintmax_t(Limits::max())) ? Limits::max() : To(v);
+            }
+
+            // Round to nearest like the vector conversions, NaN goes to the lowest value
+            template<typename To, typename From>
+            To castAs(From v, std::integral_constant<CastKind, CastKind::rounding>) noexcept
+            {
+                using Limits = std::numeric_limits<To>;
+
+                From r(std::nearbyint(v));
+
+                if(!(r > From(Limits::min()))) return Limits::min();
+                if(r >= From(Limits::max())) return Limits::max();
+
+                return To(r);
+            }
+        }
+
+        /**
+         * Value conversion used by the converting copies : integer destinations
+         * saturate and floating point sources are rounded to nearest.
+         **/
+        template<typename To, typename From>
+        To saturateCast(From v) noexcept
+        {
+            return impl::castAs<To>(v, impl::CastKindOf<To, From>());
+        }
+
+        namespace impl
+        {
+            template<typename To, typename From>
+            void convertScalar(To * dst, const From * src, SizeT size) noexcept
+            {
+                for(SizeT i(0); i < size; ++i)
+                    dst[i] = saturateCast<To>(src[i]);
+            }
+
+            /**
+             * Element by element conversion, specialized below for the pairs
+             * with vector instructions
+             **/
+            template<typename To, typename From>
+            struct ConvertKernel
+            {
+                static void run(To * dst, const From * src, SizeT size) noexcept
+                {
+                    convertScalar(dst, src, size);
+                }
+            };
+
+        #if defined(__AVX2__)
+
+            /**
+             * Kernels converting 8 elements at a time, Widen gives the 8 source
+             * elements as 32 bits lanes
+             **/
+            template<typename From, typename Widen>
+            void toFloat(float * dst, const From * src, SizeT size, Widen widen) noexcept
+            {
+                SizeT i(0);
+
+                for(; i + 8 <= size; i += 8)
+                    _mm256_storeu_ps(dst + i, widen(src + i));
+
+                convertScalar(dst + i, src + i, size - i);
+            }
+
+            template<> struct ConvertKernel<float, std::uint8_t>
+            {
+                static void run(float * dst, const std::uint8_t * src, SizeT size) noexcept
+                {
+                    toFloat(dst, src, size, [](const std::uint8_t * s)
+                    {
+                        return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(s))));
+                    });
+                }
+            };
+
+            template<> struct ConvertKernel<float, std::uint16_t>
+            {
+                static void run(float * dst, const std::uint16_t * src, SizeT size) noexcept
+                {
+                    toFloat(dst, src, size, [](const std::uint16_t * s)
+                    {
+                        return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s))));
+                    });
+                }
+            };
+
+            template<> struct ConvertKernel<float, std::int16_t>
+            {
+                static void run(float * dst, const std::int16_t * src, SizeT size) noexcept
+                {
+                    toFloat(dst, src, size, [](const std::int16_t * s)
+                    {
+                        return _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(s))));
+                    });
+                }
+            };
+
+            template<> struct ConvertKernel<float, std::int32_t>
+            {
+                static void run(float * dst, const std::int32_t * src, SizeT size) noexcept
+                {
+                    toFloat(dst, src, size, [](const std::int32_t * s)
+                    {
+                        return _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(s)));
+                    });
+                }
+            };
+
+            template<> struct ConvertKernel<float, double>
+            {
+                static void run(float * dst, const double * src, SizeT size) noexcept
+                {
+                    toFloat(dst, src, size, [](const double * s)
+                    {
+                        __m128 low = _mm256_cvtpd_ps(_mm256_loadu_pd(s));
+                        __m128 high = _mm256_cvtpd_ps(_mm256_loadu_pd(s + 4));
+                        return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+                    });
+                }
+            };
+
+            template<> struct ConvertKernel<double, std::int32_t>
+            {
+                static void run(double * dst, const std::int32_t * src, SizeT size) noexcept
+                {
+                    SizeT i(0);
+
+                    for(; i + 4 <= size; i += 4)
+                        _mm256_storeu_pd(dst + i, _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i))));
+
+                    convertScalar(dst + i, src + i, size - i);
+                }
+            };
+
+            template<> struct ConvertKernel<double, float>
+            {
+                static void run(double * dst, const float * src, SizeT size) noexcept
+                {
+                    SizeT i(0);
+
+                    for(; i + 4 <= size; i += 4)
+                        _mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_loadu_ps(src + i)));
+
+                    convertScalar(dst + i, src + i, size - i);
+                }
+            };
+
+            /**
+             * float to narrow integers : clamp in float first so the conversion
+             * never overflows (and NaN becomes the lower bound), then pack
+             **/
+            template<typename To>
+            __m256i clampRound(const float * src) noexcept
+            {
+                const __m256 lo = _mm256_set1_ps(float(std::numeric_limits<To>::min()));
+                const __m256 hi = _mm256_set1_ps(float(std::numeric_limits<To>::max()));
+
+                // max_ps returns its second operand when the first is NaN
+                return _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(src), lo), hi));
+            }
+
+            template<> struct ConvertKernel<std::uint8_t, float>
+            {
+                static void run(std::uint8_t * dst, const float * src, SizeT size) noexcept
+                {
+                    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+                    SizeT i(0);
+
+                    for(; i + 32 <= size; i += 32)
+                    {
+                        __m256i w0 = _mm256_packs_epi32(clampRound<std::uint8_t>(src + i), clampRound<std::uint8_t>(src + i + 8));
+                        __m256i w1 = _mm256_packs_epi32(clampRound<std::uint8_t>(src + i + 16), clampRound<std::uint8_t>(src + i + 24));
+
+                        // packs work per 128 bits lane, restore the element order
+                        __m256i b = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(w0, w1), order);
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), b);
+                    }
+
+                    convertScalar(dst + i, src + i, size - i);
+                }
+            };
+
+            template<> struct ConvertKernel<std::uint16_t, float>
+            {
+                static void run(std::uint16_t * dst, const float * src, SizeT size) noexcept
+                {
+                    SizeT i(0);
+
+                    for(; i + 16 <= size; i += 16)
+                    {
+                        __m256i w = _mm256_packus_epi32(clampRound<std::uint16_t>(src + i), clampRound<std::uint16_t>(src + i + 8));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_permute4x64_epi64(w, 0xD8));
+                    }
+
+                    convertScalar(dst + i, src + i, size - i);
+                }
+            };
+
+            template<> struct ConvertKernel<std::int16_t, float>
+            {
+                static void run(std::int16_t * dst, const float * src, SizeT size) noexcept
+                {
+                    SizeT i(0);
+
+                    for(; i + 16 <= size; i += 16)
+                    {
+                        __m256i w = _mm256_packs_epi32(clampRound<std::int16_t>(src + i), clampRound<std::int16_t>(src + i + 8));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_permute4x64_epi64(w, 0xD8));
+                    }
+
+                    convertScalar(dst + i, src + i, size - i);
+                }
+            };
+
+        #endif
+        }
+
+        /**
+         * Copy size elements of src to dst converting them with saturateCast
+         **/
+        template<typename To, typename From>
+        void convertCopy(To * dst, const From * src, SizeT size) noexcept
+        {
+            impl::ConvertKernel<To, From>::run(dst, src, size);
+        }
+    }
+}
+
+#endif //MA_ALGORITHM_CONVERT_COPY_H
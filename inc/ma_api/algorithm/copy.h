@@ -5,6 +5,11 @@
 #include <ma_api/function.h>
 
 #include <ma_api/iterator/StepIterator.h>
+#include <ma_api/algorithm/convertCopy.h>
+#include <ma_api/algorithm/streamCopy.h>
+#include <ma_api/algorithm/overlap.h>
+
+#include <ma_api/container/Container.h>
 
 namespace ma
 {
@@ -31,6 +36,27 @@ namespace ma
             {
                 ma::algorithm::copy(dst, src, size);
             }
+
+            static void copy(T * dst, const T * src, SizeT size, Streaming)
+            {
+                ma::algorithm::streamCopy(dst, src, size);
+            }
+        };
+
+        // Elements of different types : converting copy
+        template<typename T, typename D, typename U>
+        struct ProxyCopy<T, D *, const U *>
+        {
+            static void copy(D * dst, const U * src, SizeT size)
+            {
+                ma::algorithm::convertCopy(dst, src, size);
+            }
+
+            // The conversion is compute bound, keep regular stores
+            static void copy(D * dst, const U * src, SizeT size, Streaming)
+            {
+                ma::algorithm::convertCopy(dst, src, size);
+            }
         };
 
         template<typename T>
@@ -40,6 +66,11 @@ namespace ma
             {
                 ma::algorithm::fill(dst, src, size);
             }
+
+            static void copy(T * dst, const T & src, SizeT size, Streaming)
+            {
+                ma::algorithm::streamFill(dst, src, size);
+            }
         };
 
         template<typename T, typename DST, typename SRC, typename... Args>
@@ -53,35 +84,50 @@ namespace ma
             );
         }
 
+        /**
+         * Copies of at least streamingThreshold bytes use non temporal stores
+         **/
         template<typename T, typename DST, typename SRC, typename... Args>
         void copyPlain(DST && dst, const SRC & src, Args && ... args)
         {
             SizeT size(sizes(dst, src));
 
-            setMem<T>(
-                convert<T>(forward<DST>(dst)),
-                convert<const T &>(src),
-                size, forward<Args>(args)...
-            );
+            if(useStreaming<T>(size))
+            {
+                setMem<T>(
+                    convert<T>(forward<DST>(dst)),
+                    convert<const T &>(src),
+                    size, forward<Args>(args)..., Streaming()
+                );
+                streamFence();
+            }
+            else
+                setMem<T>(
+                    convert<T>(forward<DST>(dst)),
+                    convert<const T &>(src),
+                    size, forward<Args>(args)...
+                );
         }
 
+        /**
+         * Copy the elements [first, last) by blocks of step contiguous elements.
+         * first must be a multiple of step, the last block may be shorter.
+         **/
         template<typename T, typename DST, typename SRC, typename... Args>
-        void copyStep(DST && dst, const SRC & src, Args && ... args)
+        void copyBlocks(DST && dst, const SRC & src, SizeT step, SizeT first, SizeT last, Args && ... args)
         {
-            SizeT size(sizes(dst, src));
-
-            SizeT step(steps(dst, src));
-
             auto dstIt = iterator::stepIterator(forward<DST>(dst), step);
             auto srcIt = iterator::stepIterator(src, step);
 
-            for(SizeT i(0); i < size; i += step)
+            dstIt.advance(first / step); srcIt.advance(first / step);
+
+            for(SizeT i(first); i < last; i += step)
             {
                 setMem<T>
                 (
                     convert<T>(*dstIt),
                     convert<const T>(*srcIt),
-                    step, args...
+                    min(step, last - i), args...
                 );
 
                 ++dstIt; ++srcIt;
@@ -89,7 +135,23 @@ namespace ma
         }
 
         template<typename T, typename DST, typename SRC, typename... Args>
-        void multiCopy(DST && dst, const SRC & src, Args && ... args)
+        void copyStep(DST && dst, const SRC & src, Args && ... args)
+        {
+            SizeT size(sizes(dst, src));
+
+            SizeT step(steps(dst, src));
+
+            if(useStreaming<T>(size))
+            {
+                copyBlocks<T>(forward<DST>(dst), src, step, 0, size, forward<Args>(args)..., Streaming());
+                streamFence();
+            }
+            else
+                copyBlocks<T>(forward<DST>(dst), src, step, 0, size, forward<Args>(args)...);
+        }
+
+        template<typename T, typename DST, typename SRC, typename... Args>
+        void copyDisjoint(DST && dst, const SRC & src, Args && ... args)
         {
             if(contiguous(dst) && contiguous(src))
                 copyPlain<T>(forward<DST>(dst), src, forward<Args>(args)...);
@@ -97,6 +159,106 @@ namespace ma
                 copyStep<T>(forward<DST>(dst), src, forward<Args>(args)...);
         }
 
+        namespace impl
+        {
+            template<typename T>
+            void copyStaged(T * dst, const T * staged, SizeT size)
+            {
+                ma::algorithm::copy(dst, staged, size);
+            }
+
+            template<typename T, typename DST>
+            void copyStaged(DST && dst, const T * staged, SizeT)
+            {
+                copyDisjoint<T>(forward<DST>(dst), staged);
+            }
+        }
+
+        /**
+         * Same as copyBlocks on [0, size), from the last block to the first
+         **/
+        template<typename T, typename DST, typename SRC>
+        void copyBlocksBackward(DST && dst, const SRC & src, SizeT step, SizeT size)
+        {
+            for(SizeT first(ceil(size, step) * step); first > 0;)
+            {
+                first -= step;
+
+                auto dstIt = iterator::stepIterator(dst, step);
+                auto srcIt = iterator::stepIterator(src, step);
+
+                dstIt.advance(first / step); srcIt.advance(first / step);
+
+                const T * s(convert<const T>(*srcIt));
+                SizeT n(min(step, size - first));
+
+                ma::copy_backward(s, s + n, convert<T>(*dstIt) + n);
+            }
+        }
+
+        /**
+         * Copy between data sharing memory. With the same increasing layout on
+         * both sides the blocks are copied in the direction that reads each
+         * element before it is overwritten, like memmove. Otherwise src goes
+         * through a temporary.
+         **/
+        template<typename T, typename DST, typename SRC>
+        void copyOverlapping(DST && dst, const SRC & src)
+        {
+            SizeT size(sizes(dst, src));
+
+            bool plain(contiguous(dst) && contiguous(src));
+
+            if(plain || impl::sameIncreasingLayout(dst, src))
+            {
+                SizeT step(plain ? size : steps(dst, src));
+
+                if(convert<const T>(dst) <= convert<const T>(src))
+                    copyBlocks<T>(forward<DST>(dst), src, step, 0, size);
+                else
+                    copyBlocksBackward<T>(forward<DST>(dst), src, step, size);
+
+                return;
+            }
+
+            container::Container<T> staging(size);
+            T * tmp(staging.data());
+
+            copyDisjoint<T>(tmp, src);
+            impl::copyStaged<T>(forward<DST>(dst), const_cast<const T *>(tmp), size);
+        }
+
+        namespace impl
+        {
+            template<typename T, typename DST, typename SRC>
+            bool copyIfOverlap(DST & dst, const SRC & src, std::true_type)
+            {
+                if(!overlap<T>(dst, src))
+                    return false;
+
+                copyOverlapping<T>(dst, src);
+                return true;
+            }
+
+            template<typename T, typename DST, typename SRC>
+            constexpr bool copyIfOverlap(DST &, const SRC &, std::false_type) noexcept
+            {
+                return false;
+            }
+        }
+
+        /**
+         * Copy src to dst, data may overlap
+         **/
+        template<typename T, typename DST, typename SRC, typename... Args>
+        void multiCopy(DST && dst, const SRC & src, Args && ... args)
+        {
+            if(impl::copyIfOverlap<T>(dst, src, impl::MayOverlap<T, DST, SRC>()))
+                return;
+
+            copyDisjoint<T>(forward<DST>(dst), src, forward<Args>(args)...);
+        }
+
     }
 }
 
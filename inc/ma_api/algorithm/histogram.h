@@ -0,0 +1,356 @@
+#ifndef MA_ALGORITHM_HISTOGRAM_H
+#define MA_ALGORITHM_HISTOGRAM_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <ma_api/type.h>
+#include <ma_api/traits.h>
+#include <ma_api/function.h>
+
+#include <ma_api/algorithm/take.h>
+#include <ma_api/parallel/ThreadPool.h>
+
+namespace ma
+{
+    namespace algorithm
+    {
+        namespace impl
+        {
+            /**
+             * Visit the elements [first, last) of a view in row major order by
+             * runs of the last axis : fn(pointer, count, stride)
+             **/
+            template<typename T, typename Fn>
+            void forEachRun(const T * base, const AxisSplit & split, SizeT first, SizeT last, Fn && fn)
+            {
+                SizeT n(split.length);
+
+                while(first < last)
+                {
+                    SizeT row(first / n), col(first % n), count(ma::min(n - col, last - first));
+
+                    fn(base + split.outer.at(row) + col * split.stride, count, split.stride);
+                    first += count;
+                }
+            }
+
+            // A view without dimension holds a single element
+            inline AxisSplit rowSplit(const dimension::StridedShape & shape)
+            {
+                if(shape.ndim() == 0)
+                    return AxisSplit(dimension::StridedShape({1}, {1}), 0);
+
+                return AxisSplit(shape, shape.ndim() - 1);
+            }
+
+            /**
+             * bins of equal width over [low, high], high in the last bin.
+             * Integers with bins of width one are indexed without a multiply.
+             **/
+            struct HistogramBins
+            {
+                SizeT bins;
+                double low, high, scale;
+                bool unit;
+
+                HistogramBins(SizeT bins, double low, double high) :
+                    bins(bins), low(low), high(high), scale(double(bins) / (high - low)),
+                    unit(low == std::floor(low) && high - low == double(bins))
+                {
+                    massert(bins > 0 && low < high);
+                }
+            };
+
+            template<typename T>
+            void countRun(SizeT * counts, const T * p, SizeT n, SizeT stride, const HistogramBins & b, std::false_type) noexcept
+            {
+                for(SizeT i(0); i < n; ++i)
+                {
+                    double v(p[i * stride]);
+
+                    // NaN fails both tests
+                    if(!(v >= b.low && v <= b.high)) continue;
+
+                    ++counts[ma::min(SizeT((v - b.low) * b.scale), b.bins - 1)];
+                }
+            }
+
+            template<typename T>
+            void countRun(SizeT * counts, const T * p, SizeT n, SizeT stride, const HistogramBins & b, std::true_type) noexcept
+            {
+                if(!b.unit)
+                {
+                    countRun(counts, p, n, stride, b, std::false_type());
+                    return;
+                }
+
+                // Unit bins : the index is the value minus low, high falls in the last bin
+                long long low(static_cast<long long>(b.low));
+                unsigned long long last(static_cast<unsigned long long>(b.bins));
+
+                for(SizeT i(0); i < n; ++i)
+                {
+                    unsigned long long k(static_cast<unsigned long long>(static_cast<long long>(p[i * stride]) - low));
+
+                    if(k < last) ++counts[k];
+                    else if(k == last) ++counts[last - 1];
+                }
+            }
+
+            // Count the elements [first, last) of a view split in rows
+            template<typename T>
+            void countRange(SizeT * counts, const T * base, const AxisSplit & split, SizeT first, SizeT last, const HistogramBins & b) noexcept
+            {
+                forEachRun(base, split, first, last, [&](const T * p, SizeT n, SizeT stride)
+                {
+                    countRun(counts, p, n, stride, b, std::is_integral<T>());
+                });
+            }
+
+            // Elements counted by one thread at least
+            constexpr SizeT histogramGrain = SizeT(1) << 16;
+
+            /**
+             * Without pool, or for a source too small to split, src is counted
+             * directly in counts. Otherwise each part gets its own histogram,
+             * added to counts at the end.
+             **/
+            template<typename View>
+            void histogram(parallel::ThreadPool * pool, const View & src, SizeT bins, double low, double high, SizeT * counts)
+            {
+                using T = remove_const_t<typename View::value_type>;
+
+                HistogramBins b(bins, low, high);
+                AxisSplit split(rowSplit(dimension::stridedShape(src.layout())));
+
+                const T * base(&*src.ptr());
+                SizeT size(split.outer.size() * split.length);
+                SizeT parts(pool ? ma::max(SizeT(1), ma::min(pool->size(), size / histogramGrain)) : 1);
+
+                ma::fill_n(counts, bins, SizeT(0));
+
+                if(parts == 1)
+                {
+                    countRange(counts, base, split, 0, size, b);
+                    return;
+                }
+
+                SizeT partSize(ceil(size, parts));
+                std::vector<SizeT> partial(parts * bins, 0);
+
+                pool->parallelFor(0, parts, 1, [&](SizeT first, SizeT last)
+                {
+                    for(SizeT part(first); part < last; ++part)
+                        countRange(partial.data() + part * bins, base, split, part * partSize, ma::min(size, (part + 1) * partSize), b);
+                });
+
+                for(SizeT part(0); part < parts; ++part)
+                    for(SizeT i(0); i < bins; ++i)
+                        counts[i] += partial[part * bins + i];
+            }
+        }
+
+        /**
+         * Count the elements of src in bins of equal width over [low, high],
+         * high being counted in the last bin. Elements out of range and NaN
+         * are ignored. Each thread of pool fills its own histogram on a part
+         * of src, then they are added to counts, which holds bins values.
+         * Without pool, src is counted on the calling thread.
+         **/
+        template<typename View>
+        void histogram(parallel::ThreadPool & pool, const View & src, SizeT bins, double low, double high, SizeT * counts)
+        {
+            impl::histogram(&pool, src, bins, low, high, counts);
+        }
+
+        template<typename View>
+        void histogram(const View & src, SizeT bins, double low, double high, SizeT * counts)
+        {
+            impl::histogram(nullptr, src, bins, low, high, counts);
+        }
+
+        /**
+         * Approximate quantile q in [0, 1] from a histogram of bins over
+         * [low, high], interpolated inside the bin holding it. The error is
+         * at most the width of a bin. NaN for an empty histogram.
+         **/
+        inline double histogramQuantile(const SizeT * counts, SizeT bins, double low, double high, double q)
+        {
+            massert(q >= 0. && q <= 1.);
+
+            SizeT total(0);
+            for(SizeT i(0); i < bins; ++i) total += counts[i];
+
+            if(total == 0) return std::numeric_limits<double>::quiet_NaN();
+
+            double target(q * double(total)), cumulated(0.), width((high - low) / double(bins));
+
+            for(SizeT i(0); i < bins; ++i)
+            {
+                if(counts[i] > 0 && cumulated + double(counts[i]) >= target)
+                    return low + (double(i) + (target - cumulated) / double(counts[i])) * width;
+
+                cumulated += double(counts[i]);
+            }
+
+            return high;
+        }
+
+        namespace impl
+        {
+            // Elements of src without NaN, in a dense buffer that the selections can reorder
+            template<typename View>
+            std::vector<remove_const_t<typename View::value_type>> gatherValues(const View & src)
+            {
+                using T = remove_const_t<typename View::value_type>;
+
+                AxisSplit split(rowSplit(dimension::stridedShape(src.layout())));
+                SizeT size(split.outer.size() * split.length);
+
+                std::vector<T> values;
+                values.reserve(size);
+
+                forEachRun(&*src.ptr(), split, 0, size, [&](const T * p, SizeT n, SizeT stride)
+                {
+                    for(SizeT i(0); i < n; ++i)
+                        if(p[i * stride] == p[i * stride]) values.push_back(p[i * stride]);
+                });
+
+                return values;
+            }
+
+            /**
+             * Quantile q of values[first, n), knowing that values[0, first) are
+             * lower : selection of the order statistic below q * (n - 1) and
+             * linear interpolation with the next one
+             **/
+            template<typename T>
+            double selectQuantile(std::vector<T> & values, SizeT first, double q)
+            {
+                SizeT n(SizeT(values.size()));
+                double pos(q * double(n - 1));
+                SizeT k(ma::min(SizeT(pos), n - 1));
+                double frac(pos - double(k));
+
+                std::nth_element(values.begin() + first, values.begin() + k, values.end());
+
+                double lowValue(values[k]);
+                if(frac == 0. || k + 1 == n) return lowValue;
+
+                double highValue(*std::min_element(values.begin() + k + 1, values.end()));
+
+                return lowValue + frac * (highValue - lowValue);
+            }
+
+            // Order of the quantiles, lowest first
+            inline std::vector<SizeT> ascending(const std::vector<double> & qs)
+            {
+                std::vector<SizeT> order(qs.size());
+                for(SizeT i(0); i < SizeT(order.size()); ++i) order[i] = i;
+                std::sort(order.begin(), order.end(), [&](SizeT a, SizeT b){ return qs[a] < qs[b]; });
+
+                return order;
+            }
+
+            template<typename View>
+            std::vector<double> quantiles(const View & src, const std::vector<double> & qs, std::false_type)
+            {
+                auto values(gatherValues(src));
+
+                std::vector<double> res(qs.size(), std::numeric_limits<double>::quiet_NaN());
+                if(values.empty()) return res;
+
+                SizeT first(0);
+                for(auto i : ascending(qs))
+                {
+                    massert(qs[i] >= 0. && qs[i] <= 1.);
+
+                    res[i] = selectQuantile(values, first, qs[i]);
+                    first = ma::min(SizeT(qs[i] * double(values.size() - 1)), SizeT(values.size()) - 1);
+                }
+
+                return res;
+            }
+
+            /**
+             * Integers of 8 and 16 bits : one count per possible value, the
+             * order statistics are read from the cumulated counts
+             **/
+            template<typename View>
+            std::vector<double> quantiles(const View & src, const std::vector<double> & qs, std::true_type)
+            {
+                using T = remove_const_t<typename View::value_type>;
+
+                constexpr SizeT bins(SizeT(1) << (8 * sizeof(T)));
+                constexpr double low(std::numeric_limits<T>::lowest());
+
+                std::vector<SizeT> counts(bins, 0);
+                HistogramBins b(bins, low, low + double(bins));
+
+                AxisSplit split(rowSplit(dimension::stridedShape(src.layout())));
+                SizeT size(split.outer.size() * split.length);
+
+                countRange(counts.data(), &*src.ptr(), split, 0, size, b);
+
+                std::vector<double> res(qs.size(), std::numeric_limits<double>::quiet_NaN());
+                if(size == 0) return res;
+
+                for(SizeT i(1); i < bins; ++i) counts[i] += counts[i - 1];
+
+                // Value of order k : first value whose cumulated count exceeds k
+                auto orderStatistic = [&](SizeT k)
+                {
+                    return low + double(std::upper_bound(counts.begin(), counts.end(), k) - counts.begin());
+                };
+
+                for(SizeT i(0); i < SizeT(qs.size()); ++i)
+                {
+                    massert(qs[i] >= 0. && qs[i] <= 1.);
+
+                    double pos(qs[i] * double(size - 1));
+                    SizeT k(ma::min(SizeT(pos), size - 1));
+                    double frac(pos - double(k)), lowValue(orderStatistic(k));
+
+                    res[i] = (frac == 0. || k + 1 == size) ? lowValue : lowValue + frac * (orderStatistic(k + 1) - lowValue);
+                }
+
+                return res;
+            }
+
+            template<typename T>
+            using Countable = std::integral_constant<bool,
+                std::is_integral<T>::value && !std::is_same<T, bool>::value && sizeof(T) <= 2
+            >;
+        }
+
+        /**
+         * Exact quantiles qs in [0, 1] of src, NaN ignored, with the linear
+         * interpolation between order statistics of numpy. The elements are
+         * copied once and partially ordered by selection, from the lowest
+         * quantile to the highest, instead of being sorted. Integers of 8
+         * and 16 bits are counted instead of copied.
+         **/
+        template<typename View>
+        std::vector<double> quantiles(const View & src, const std::vector<double> & qs)
+        {
+            return impl::quantiles(src, qs, impl::Countable<remove_const_t<typename View::value_type>>());
+        }
+
+        template<typename View>
+        double quantile(const View & src, double q)
+        {
+            return quantiles(src, {q})[0];
+        }
+
+        template<typename View>
+        double median(const View & src)
+        {
+            return quantile(src, 0.5);
+        }
+    }
+}
+
+#endif //MA_ALGORITHM_HISTOGRAM_H
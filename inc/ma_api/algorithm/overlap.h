@@ -0,0 +1,157 @@
+#ifndef MA_ALGORITHM_OVERLAP_H
+#define MA_ALGORITHM_OVERLAP_H
+
+#include <cstdint>
+
+#include <ma_api/type.h>
+#include <ma_api/traits.h>
+#include <ma_api/function.h>
+
+namespace ma
+{
+    namespace algorithm
+    {
+        namespace impl
+        {
+            /**
+             * Bytes [begin, end) holding the elements of a view or a pointer
+             **/
+            struct AddressSpan
+            {
+                std::uintptr_t begin;
+                std::uintptr_t end;
+            };
+
+            template<typename T, typename Data>
+            using IsViewOf = enable_if_t<
+                has_strided_layout<Data>::value &&
+                std::is_same<decay_t<decltype(*std::declval<const Data &>().ptr())>, T>::value,
+                AddressSpan
+            >;
+
+            template<typename T, typename Data>
+            auto addressSpan(const Data & data, SizeT) -> IsViewOf<T, Data>
+            {
+                VectRange shape(data.shape()), strides(data.strides());
+
+                SizeT low(0), high(0);
+
+                for(SizeT d(0); d < SizeT(shape.size()); ++d)
+                {
+                    if(shape[d] == 0) return AddressSpan{0, 0};
+
+                    SizeT offset((shape[d] - 1) * strides[d]);
+
+                    if(offset < 0) low += offset; else high += offset;
+                }
+
+                std::uintptr_t first(reinterpret_cast<std::uintptr_t>(&*data.ptr()));
+
+                return AddressSpan{
+                    first - std::uintptr_t(-low) * sizeof(T),
+                    first + std::uintptr_t(high + 1) * sizeof(T)
+                };
+            }
+
+            template<typename T, typename Data>
+            auto addressSpan(const Data & data, SizeT size) -> enable_if_t<
+                is_pointer<Data>::value && std::is_same<decay_t<decltype(*data)>, T>::value, AddressSpan
+            >
+            {
+                std::uintptr_t first(reinterpret_cast<std::uintptr_t>(data));
+
+                return AddressSpan{first, first + std::uintptr_t(size) * sizeof(T)};
+            }
+
+            template<typename T, typename Data>
+            auto has_span_impl(int) -> decltype(
+                addressSpan<T>(std::declval<const Data &>(), SizeT()),
+                std::true_type{});
+
+            template<typename T, typename Data>
+            std::false_type has_span_impl(...);
+
+            template<typename T, typename Data>
+            using has_span = decltype(has_span_impl<T, decay_t<Data>>(0));
+
+            /**
+             * Both data may share memory : views or pointers of T, at least one
+             * view to give the extent of the pointers
+             **/
+            template<typename T, typename DST, typename SRC>
+            using MayOverlap = std::integral_constant<bool,
+                (has_strided_layout<decay_t<DST>>::value || has_strided_layout<decay_t<SRC>>::value) &&
+                has_span<T, DST>::value && has_span<T, SRC>::value
+            >;
+
+            template<typename T, typename DST, typename SRC>
+            bool overlap(const DST & dst, const SRC & src)
+            {
+                SizeT size(sizes(dst, src));
+
+                AddressSpan d(addressSpan<T>(dst, size)), s(addressSpan<T>(src, size));
+
+                return d.begin < s.end && s.begin < d.end;
+            }
+
+            // Dimensions of a single element do not change the order of the addresses
+            inline void dropUnitDims(VectRange & shape, VectRange & strides)
+            {
+                SizeT kept(0);
+
+                for(SizeT d(0); d < SizeT(shape.size()); ++d)
+                    if(shape[d] != 1)
+                    {
+                        shape[kept] = shape[d];
+                        strides[kept] = strides[d];
+                        ++kept;
+                    }
+
+                shape.resize(kept);
+                strides.resize(kept);
+            }
+
+            // Row major order visits strictly increasing addresses
+            inline bool increasingLayout(const VectRange & shape, const VectRange & strides) noexcept
+            {
+                SizeT extent(1);
+
+                for(SizeT d(SizeT(shape.size()) - 1); d >= 0; --d)
+                {
+                    if(strides[d] < extent) return false;
+
+                    extent = strides[d] * (shape[d] - 1) + 1;
+                }
+
+                return true;
+            }
+
+            /**
+             * Same strides on both sides and addresses increasing in row major
+             * order : element i of dst is element i of src moved by a constant,
+             * so a memmove like direction choice is enough
+             **/
+            template<typename DST, typename SRC>
+            auto sameIncreasingLayout(const DST & dst, const SRC & src) -> enable_if_t<
+                has_strided_layout<DST>::value && has_strided_layout<SRC>::value, bool
+            >
+            {
+                VectRange dShape(dst.shape()), dStrides(dst.strides());
+                VectRange sShape(src.shape()), sStrides(src.strides());
+
+                dropUnitDims(dShape, dStrides);
+                dropUnitDims(sShape, sStrides);
+
+                return dShape == sShape && dStrides == sStrides && increasingLayout(dShape, dStrides);
+            }
+
+            template<typename... Data>
+            constexpr bool sameIncreasingLayout(const Data & ...) noexcept
+            {
+                return false;
+            }
+        }
+    }
+}
+
+#endif //MA_ALGORITHM_OVERLAP_H
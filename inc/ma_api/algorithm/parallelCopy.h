@@ -0,0 +1,52 @@
+#ifndef MA_ALGORITHM_PARALLEL_COPY_H
+#define MA_ALGORITHM_PARALLEL_COPY_H
+
+#include <ma_api/algorithm/copy.h>
+#include <ma_api/parallel/ThreadPool.h>
+
+namespace ma
+{
+    namespace algorithm
+    {
+        /**
+         * Number of bytes under which a copy stay on the calling thread
+         **/
+        inline SizeT & parallelCopyThreshold() noexcept
+        {
+            static SizeT threshold(SizeT(1) << 22);
+            return threshold;
+        }
+
+        /**
+         * Same as multiCopy but split the blocks between the threads of pool
+         * when the copy is larger than parallelCopyThreshold
+         **/
+        template<typename T, typename DST, typename SRC>
+        void multiCopyParallel(parallel::ThreadPool & pool, DST && dst, const SRC & src)
+        {
+            SizeT size(sizes(dst, src)), threadNb(pool.size());
+
+            if(threadNb <= 1 || size * SizeT(sizeof(T)) < parallelCopyThreshold())
+            {
+                multiCopy<T>(forward<DST>(dst), src);
+                return;
+            }
+
+            // Contiguous data can be cut anywhere
+            SizeT step(
+                (contiguous(dst) && contiguous(src))
+                ? ceil(size, threadNb)
+                : steps(dst, src)
+            );
+
+            SizeT blockNb(ceil(size, step));
+
+            pool.parallelFor(0, blockNb, ceil(blockNb, threadNb), [&](SizeT first, SizeT last)
+            {
+                copyBlocks<T>(dst, src, step, first * step, min(size, last * step));
+            });
+        }
+    }
+}
+
+#endif //MA_ALGORITHM_PARALLEL_COPY_H
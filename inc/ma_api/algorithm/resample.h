@@ -0,0 +1,352 @@
+#ifndef MA_ALGORITHM_RESAMPLE_H
+#define MA_ALGORITHM_RESAMPLE_H
+
+#include <cmath>
+#include <vector>
+
+#include <ma_api/type.h>
+#include <ma_api/traits.h>
+#include <ma_api/function.h>
+
+#include <ma_api/algorithm/convertCopy.h>
+#include <ma_api/parallel/ThreadPool.h>
+
+namespace ma
+{
+    namespace algorithm
+    {
+        enum class Interpolation { linear, cubic };
+
+        /**
+         * Source coordinate of the destination index i along one axis :
+         * i * scale + offset, in element units
+         **/
+        struct AxisMap
+        {
+            double scale;
+            double offset;
+        };
+
+        /**
+         * Map of a resampling from srcLength to dstLength elements keeping
+         * the centers of the first and last elements aligned
+         **/
+        inline AxisMap fitAxis(SizeT srcLength, SizeT dstLength) noexcept
+        {
+            double scale(dstLength > 0 ? double(srcLength) / double(dstLength) : 1.);
+
+            return {scale, 0.5 * scale - 0.5};
+        }
+
+        /**
+         * Map of a translation : destination i reads the source at i - shift
+         **/
+        inline AxisMap shiftAxis(double shift) noexcept
+        {
+            return {1., -shift};
+        }
+
+        namespace impl
+        {
+            /**
+             * Integers up to 16 bits and float are interpolated in float,
+             * other types in double
+             **/
+            template<typename T>
+            using WorkType = conditional_t<
+                std::is_same<T, float>::value || (std::is_integral<T>::value && sizeof(T) <= 2),
+                float, double
+            >;
+
+            inline SizeT tapsOf(Interpolation interpolation) noexcept
+            {
+                return interpolation == Interpolation::linear ? 2 : 4;
+            }
+
+            // Keys cubic convolution with a = -0.5 (Catmull-Rom)
+            inline void cubicWeights(double f, double * w) noexcept
+            {
+                double f2(f * f), f3(f2 * f);
+
+                w[0] = -0.5 * f3 + f2 - 0.5 * f;
+                w[1] = 1.5 * f3 - 2.5 * f2 + 1.;
+                w[2] = -1.5 * f3 + 2. * f2 + 0.5 * f;
+                w[3] = 0.5 * f3 - 0.5 * f2;
+            }
+
+            /**
+             * Separable weights of one axis, tap t of destination i reads the
+             * source at offset[t * length + i] with weight[t * length + i].
+             * Offsets are clamped to the source, edges are repeated, and
+             * premultiplied by the source stride.
+             * A translation has the same weights everywhere and reads
+             * consecutive elements between lo and hi : uniform is set and
+             * tap t of i reads (first + i + t) * stride.
+             **/
+            template<typename Work>
+            struct WeightTable
+            {
+                SizeT taps, length, stride;
+                std::vector<SizeT> offset;
+                std::vector<Work> weight;
+                bool uniform;
+                SizeT first, lo, hi;
+
+                WeightTable(Interpolation interpolation, AxisMap map, SizeT srcLength, SizeT dstLength, SizeT stride) :
+                    taps(tapsOf(interpolation)), length(dstLength), stride(stride),
+                    offset(taps * dstLength), weight(taps * dstLength),
+                    uniform(map.scale == 1.), first(0), lo(0), hi(0)
+                {
+                    massert(srcLength > 0);
+
+                    for(SizeT i(0); i < dstLength; ++i)
+                    {
+                        double x(double(i) * map.scale + map.offset), base(std::floor(x)), f(x - base), w[4];
+                        SizeT start(static_cast<SizeT>(base));
+
+                        if(interpolation == Interpolation::linear)
+                        {
+                            w[0] = 1. - f; w[1] = f;
+                        }
+                        else
+                        {
+                            cubicWeights(f, w);
+                            start -= 1;
+                        }
+
+                        if(i == 0) first = start;
+
+                        for(SizeT t(0); t < taps; ++t)
+                        {
+                            offset[t * length + i] = ma::min(ma::max(start + t, SizeT(0)), srcLength - 1) * stride;
+                            weight[t * length + i] = Work(w[t]);
+                        }
+                    }
+
+                    if(uniform)
+                    {
+                        lo = ma::min(ma::max(-first, SizeT(0)), dstLength);
+                        hi = ma::max(ma::min(srcLength - taps + 1 - first, dstLength), lo);
+                    }
+                }
+            };
+
+            /**
+             * out[j] = sum of the taps of src along the row for j in [first,
+             * last), the tap loop is unrolled and the loop over j vectorizes
+             * with gathers
+             **/
+            template<SizeT Taps, typename Work, typename T>
+            void horizontal(Work * out, const T * row, const WeightTable<Work> & cols, SizeT first, SizeT last) noexcept
+            {
+                SizeT n(cols.length);
+                const SizeT * offset(cols.offset.data());
+                const Work * weight(cols.weight.data());
+
+                for(SizeT j(first); j < last; ++j)
+                {
+                    Work s(0);
+                    for(SizeT t(0); t < Taps; ++t)
+                        s += weight[t * n + j] * Work(row[offset[t * n + j]]);
+                    out[j] = s;
+                }
+            }
+
+            // Same weights for all j : contiguous loads away from the edges
+            template<SizeT Taps, typename Work, typename T>
+            void horizontalUniform(Work * out, const T * row, const WeightTable<Work> & cols) noexcept
+            {
+                SizeT n(cols.length), stride(cols.stride);
+                const T * src(row + cols.first * stride);
+                Work w[Taps];
+
+                for(SizeT t(0); t < Taps; ++t) w[t] = cols.weight[t * n];
+
+                horizontal<Taps>(out, row, cols, 0, cols.lo);
+
+                if(stride == 1)
+                    for(SizeT j(cols.lo); j < cols.hi; ++j)
+                    {
+                        Work s(0);
+                        for(SizeT t(0); t < Taps; ++t)
+                            s += w[t] * Work(src[j + t]);
+                        out[j] = s;
+                    }
+                else
+                    for(SizeT j(cols.lo); j < cols.hi; ++j)
+                    {
+                        Work s(0);
+                        for(SizeT t(0); t < Taps; ++t)
+                            s += w[t] * Work(src[(j + t) * stride]);
+                        out[j] = s;
+                    }
+
+                horizontal<Taps>(out, row, cols, cols.hi, n);
+            }
+
+            template<SizeT Taps, typename Work, typename T>
+            void horizontal(Work * out, const T * row, const WeightTable<Work> & cols) noexcept
+            {
+                if(cols.uniform)
+                    horizontalUniform<Taps>(out, row, cols);
+                else
+                    horizontal<Taps>(out, row, cols, 0, cols.length);
+            }
+
+            // Contiguous rows of the horizontal pass combined with the weights of one output row
+            template<SizeT Taps, typename Work, typename D>
+            void vertical(D * dst, const Work * const * rows, const Work * w, SizeT n) noexcept
+            {
+                for(SizeT j(0); j < n; ++j)
+                {
+                    Work s(0);
+                    for(SizeT t(0); t < Taps; ++t)
+                        s += w[t] * rows[t][j];
+                    dst[j] = saturateCast<D>(s);
+                }
+            }
+
+            /**
+             * Horizontal passes of the last source rows. The least recently
+             * used row is replaced : with one slot per tap, the rows of the
+             * current destination row are never evicted.
+             **/
+            template<typename Work>
+            struct RowCache
+            {
+                std::vector<Work> data;
+                std::vector<SizeT> key;
+                std::vector<SizeT> used;
+                SizeT length, clock;
+
+                RowCache(SizeT taps, SizeT length) :
+                    data(taps * length), key(taps), used(taps, 0), length(length), clock(0)
+                {}
+
+                template<SizeT Taps, typename T>
+                const Work * row(const T * src, SizeT rowOffset, const WeightTable<Work> & cols)
+                {
+                    SizeT slot(0);
+                    ++clock;
+
+                    for(SizeT s(0); s < SizeT(key.size()); ++s)
+                    {
+                        if(used[s] != 0 && key[s] == rowOffset)
+                        {
+                            used[s] = clock;
+                            return data.data() + s * length;
+                        }
+
+                        if(used[s] < used[slot]) slot = s;
+                    }
+
+                    key[slot] = rowOffset;
+                    used[slot] = clock;
+                    horizontal<Taps>(data.data() + slot * length, src + rowOffset, cols);
+
+                    return data.data() + slot * length;
+                }
+            };
+
+            template<SizeT Taps, typename Work, typename T, typename D>
+            void resampleRows(const T * src, D * dst, const WeightTable<Work> & rows, const WeightTable<Work> & cols, SizeT first, SizeT last)
+            {
+                RowCache<Work> cache(Taps, cols.length);
+
+                for(SizeT i(first); i < last; ++i)
+                {
+                    const Work * taps[Taps];
+                    Work w[Taps];
+
+                    // Taps clamped to the same edge row are computed once
+                    for(SizeT t(0); t < Taps; ++t)
+                    {
+                        taps[t] = cache.template row<Taps>(src, rows.offset[t * rows.length + i], cols);
+                        w[t] = rows.weight[t * rows.length + i];
+                    }
+
+                    vertical<Taps>(dst + i * cols.length, taps, w, cols.length);
+                }
+            }
+
+            template<typename Work, typename T, typename D>
+            void resampleRange(const T * src, D * dst, const WeightTable<Work> & rows, const WeightTable<Work> & cols, SizeT first, SizeT last)
+            {
+                if(rows.taps == 2)
+                    resampleRows<2>(src, dst, rows, cols, first, last);
+                else
+                    resampleRows<4>(src, dst, rows, cols, first, last);
+            }
+
+            // Destination rows per task of the thread pool
+            constexpr SizeT resampleGrain = 8;
+
+            template<typename View, typename D>
+            void resample(parallel::ThreadPool * pool, const View & src, AxisMap rowMap, AxisMap colMap,
+                SizeT dstRows, SizeT dstCols, D * dst, Interpolation interpolation)
+            {
+                using T = remove_const_t<typename View::value_type>;
+                using Work = WorkType<T>;
+
+                throwIfMismatch(src.ndim(), 2, "ERROR : resampling needs 2 dimensions");
+
+                VectRange shape(src.shape()), strides(src.strides());
+
+                if(dstRows == 0 || dstCols == 0) return;
+
+                WeightTable<Work> rows(interpolation, rowMap, shape[0], dstRows, strides[0]);
+                WeightTable<Work> cols(interpolation, colMap, shape[1], dstCols, strides[1]);
+
+                const T * base(&*src.ptr());
+
+                if(pool)
+                    pool->parallelFor(0, dstRows, resampleGrain, [&](SizeT first, SizeT last)
+                    {
+                        resampleRange(base, dst, rows, cols, first, last);
+                    });
+                else
+                    resampleRange(base, dst, rows, cols, 0, dstRows);
+            }
+        }
+
+        /**
+         * Bilinear or bicubic resampling of the 2 dimensions view src to the
+         * dense buffer dst of dstRows x dstCols elements. Destination (i, j)
+         * reads the source at (rowMap(i), colMap(j)), coordinates out of the
+         * source repeat its edges. Weights are computed once per axis, rows
+         * are interpolated first then combined by columns. Results saturate
+         * to the type of dst.
+         **/
+        template<typename View, typename D>
+        void resample(const View & src, AxisMap rowMap, AxisMap colMap, SizeT dstRows, SizeT dstCols, D * dst,
+            Interpolation interpolation = Interpolation::linear)
+        {
+            impl::resample(nullptr, src, rowMap, colMap, dstRows, dstCols, dst, interpolation);
+        }
+
+        /**
+         * Same with the destination rows split between the threads of pool
+         **/
+        template<typename View, typename D>
+        void resample(parallel::ThreadPool & pool, const View & src, AxisMap rowMap, AxisMap colMap, SizeT dstRows, SizeT dstCols, D * dst,
+            Interpolation interpolation = Interpolation::linear)
+        {
+            impl::resample(&pool, src, rowMap, colMap, dstRows, dstCols, dst, interpolation);
+        }
+
+        /**
+         * Sub pixel translation : dst(i, j) = src(i - dy, j - dx), dst has the
+         * shape of src
+         **/
+        template<typename View, typename D>
+        void translate(const View & src, double dy, double dx, D * dst, Interpolation interpolation = Interpolation::linear)
+        {
+            VectRange shape(src.shape());
+            throwIfMismatch(ma::size(shape), 2, "ERROR : resampling needs 2 dimensions");
+
+            resample(src, shiftAxis(dy), shiftAxis(dx), shape[0], shape[1], dst, interpolation);
+        }
+    }
+}
+
+#endif //MA_ALGORITHM_RESAMPLE_H
@@ -0,0 +1,250 @@
+#ifndef MA_ALGORITHM_SCAN_H
+#define MA_ALGORITHM_SCAN_H
+
+#include <limits>
+#include <vector>
+
+#include <ma_api/type.h>
+#include <ma_api/traits.h>
+#include <ma_api/function.h>
+
+#include <ma_api/algorithm/take.h>
+#include <ma_api/parallel/ThreadPool.h>
+
+namespace ma
+{
+    namespace algorithm
+    {
+        enum class ScanMode { inclusive, exclusive };
+
+        /**
+         * Associative operations of the scans, with their identity element.
+         * Any type with the same two members can be given to scan.
+         **/
+        struct ScanSum
+        {
+            template<typename T> static constexpr T identity() noexcept { return T(0); }
+            template<typename T> constexpr T operator()(T a, T b) const noexcept { return a + b; }
+        };
+
+        struct ScanProd
+        {
+            template<typename T> static constexpr T identity() noexcept { return T(1); }
+            template<typename T> constexpr T operator()(T a, T b) const noexcept { return a * b; }
+        };
+
+        struct ScanMax
+        {
+            template<typename T> static constexpr T identity() noexcept { return std::numeric_limits<T>::lowest(); }
+            template<typename T> constexpr T operator()(T a, T b) const noexcept { return a < b ? b : a; }
+        };
+
+        struct ScanMin
+        {
+            template<typename T> static constexpr T identity() noexcept { return std::numeric_limits<T>::max(); }
+            template<typename T> constexpr T operator()(T a, T b) const noexcept { return b < a ? b : a; }
+        };
+
+        namespace impl
+        {
+            /**
+             * Scan of n elements of src spaced by stride to the contiguous dst,
+             * starting from carry. src is read before dst is written, so both
+             * may be the same memory. Returns the combination of all elements.
+             **/
+            template<typename D, typename T, typename Op>
+            D scanLine(const T * src, SizeT stride, D * dst, SizeT n, Op op, ScanMode mode, D carry)
+            {
+                if(mode == ScanMode::inclusive)
+                    for(SizeT k(0); k < n; ++k)
+                    {
+                        carry = op(carry, D(src[k * stride]));
+                        dst[k] = carry;
+                    }
+                else
+                    for(SizeT k(0); k < n; ++k)
+                    {
+                        D v(src[k * stride]);
+                        dst[k] = carry;
+                        carry = op(carry, v);
+                    }
+
+                return carry;
+            }
+
+            /**
+             * Lanes [first, last) of inner scanned together along the axis :
+             * one running value per lane, updated for each step of the axis.
+             * With contiguous lanes the loop over them vectorizes.
+             **/
+            template<typename D, typename T, typename Op>
+            void scanLanes(const T * src, const AxisSplit & split, D * dst, SizeT first, SizeT last, Op op, ScanMode mode)
+            {
+                SizeT nb(last - first), innerSize(split.inner.size());
+
+                std::vector<D> carry(nb, Op::template identity<D>());
+                std::vector<SizeT> offsets;
+
+                bool dense(split.inner.contiguous());
+                if(!dense)
+                {
+                    offsets.resize(nb);
+                    for(SizeT l(0); l < nb; ++l) offsets[l] = split.inner.at(first + l);
+                }
+
+                D * c(carry.data());
+
+                for(SizeT k(0); k < split.length; ++k)
+                {
+                    const T * s(src + k * split.stride);
+                    D * d(dst + k * innerSize + first);
+
+                    if(dense)
+                    {
+                        s += first;
+
+                        if(mode == ScanMode::inclusive)
+                            for(SizeT l(0); l < nb; ++l) { c[l] = op(c[l], D(s[l])); d[l] = c[l]; }
+                        else
+                            for(SizeT l(0); l < nb; ++l) { D v(s[l]); d[l] = c[l]; c[l] = op(c[l], v); }
+                    }
+                    else
+                    {
+                        if(mode == ScanMode::inclusive)
+                            for(SizeT l(0); l < nb; ++l) { c[l] = op(c[l], D(s[offsets[l]])); d[l] = c[l]; }
+                        else
+                            for(SizeT l(0); l < nb; ++l) { D v(s[offsets[l]]); d[l] = c[l]; c[l] = op(c[l], v); }
+                    }
+                }
+            }
+
+            // Elements per block of the parallel scan of a single line
+            constexpr SizeT scanBlock = SizeT(1) << 15;
+
+            // Lanes scanned together by one task, their running values stay in L1
+            constexpr SizeT laneBlock = 4096;
+
+            /**
+             * Single long line : each thread scans its block, the totals of
+             * the blocks are scanned, then each block but the first is
+             * combined with the total of the previous ones
+             **/
+            template<typename D, typename T, typename Op>
+            void scanBlocked(parallel::ThreadPool & pool, const T * src, SizeT stride, D * dst, SizeT n, Op op, ScanMode mode, SizeT blocks)
+            {
+                SizeT blockSize(ceil(n, blocks));
+                std::vector<D> totals(blocks, Op::template identity<D>());
+
+                pool.parallelFor(0, blocks, 1, [&](SizeT firstBlock, SizeT lastBlock)
+                {
+                    for(SizeT b(firstBlock); b < lastBlock; ++b)
+                    {
+                        SizeT first(b * blockSize), last(ma::min(n, first + blockSize));
+                        if(first < last)
+                            totals[b] = scanLine(src + first * stride, stride, dst + first, last - first, op, mode, Op::template identity<D>());
+                    }
+                });
+
+                for(SizeT b(1); b < blocks; ++b)
+                    totals[b] = op(totals[b - 1], totals[b]);
+
+                pool.parallelFor(1, blocks, 1, [&](SizeT firstBlock, SizeT lastBlock)
+                {
+                    for(SizeT b(firstBlock); b < lastBlock; ++b)
+                    {
+                        D offset(totals[b - 1]);
+                        SizeT first(b * blockSize), last(ma::min(n, first + blockSize));
+
+                        for(SizeT k(first); k < last; ++k)
+                            dst[k] = op(offset, dst[k]);
+                    }
+                });
+            }
+
+            // Lines [first, last) of outer scanned one after the other
+            template<typename D, typename T, typename Op>
+            void scanLines(const T * src, const AxisSplit & split, D * dst, SizeT first, SizeT last, Op op, ScanMode mode)
+            {
+                for(SizeT o(first); o < last; ++o)
+                    scanLine(src + split.outer.at(o), split.stride, dst + o * split.length, split.length, op, mode, Op::template identity<D>());
+            }
+
+            // Tasks [first, last) of laneBlock lanes, laneTasks per element of outer
+            template<typename D, typename T, typename Op>
+            void scanLaneTasks(const T * src, const AxisSplit & split, D * dst, SizeT laneTasks, SizeT first, SizeT last, Op op, ScanMode mode)
+            {
+                SizeT innerSize(split.inner.size());
+
+                for(SizeT task(first); task < last; ++task)
+                {
+                    SizeT o(task / laneTasks), l0((task % laneTasks) * laneBlock);
+
+                    scanLanes(src + split.outer.at(o), split, dst + o * split.length * innerSize, l0, ma::min(innerSize, l0 + laneBlock), op, mode);
+                }
+            }
+
+            template<typename D, typename T, typename Op>
+            void scan(parallel::ThreadPool * pool, const T * src, const AxisSplit & split, D * dst, Op op, ScanMode mode)
+            {
+                SizeT outerSize(split.outer.size()), innerSize(split.inner.size()), length(split.length);
+
+                if(length == 0 || innerSize == 0) return;
+
+                if(innerSize == 1)
+                {
+                    SizeT blocks(pool ? ma::min(pool->size(), length / scanBlock) : 1);
+
+                    if(outerSize == 1 && blocks > 1)
+                        scanBlocked(*pool, src + split.outer.at(0), split.stride, dst, length, op, mode, blocks);
+                    else if(pool)
+                        pool->parallelFor(0, outerSize, ma::max(SizeT(1), scanBlock / length), [&](SizeT first, SizeT last)
+                        {
+                            scanLines(src, split, dst, first, last, op, mode);
+                        });
+                    else
+                        scanLines(src, split, dst, 0, outerSize, op, mode);
+
+                    return;
+                }
+
+                SizeT laneTasks(ceil(innerSize, laneBlock));
+
+                if(pool)
+                    pool->parallelFor(0, outerSize * laneTasks, 1, [&](SizeT first, SizeT last)
+                    {
+                        scanLaneTasks(src, split, dst, laneTasks, first, last, op, mode);
+                    });
+                else
+                    scanLaneTasks(src, split, dst, laneTasks, 0, outerSize * laneTasks, op, mode);
+            }
+        }
+
+        /**
+         * Cumulative op of src along axis written to the dense buffer dst of
+         * the shape of src : inclusive, dst[k] = src[0] op ... op src[k], or
+         * exclusive, dst[k] = identity op src[0] op ... op src[k - 1].
+         * Values are converted to the type of dst before being combined.
+         * dst may be the memory of a dense src, to scan in place.
+         * A single long line is cut in blocks scanned by the threads of pool,
+         * scans along an outer axis run on all the inner elements at once.
+         * Without pool, src is scanned on the calling thread.
+         **/
+        template<typename View, typename D, typename Op>
+        void scan(parallel::ThreadPool & pool, const View & src, D * dst, Op op, SizeT axis, ScanMode mode = ScanMode::inclusive)
+        {
+            impl::AxisSplit split(dimension::stridedShape(src.layout()), axis);
+
+            impl::scan(&pool, &*src.ptr(), split, dst, op, mode);
+        }
+
+        template<typename View, typename D, typename Op>
+        void scan(const View & src, D * dst, Op op, SizeT axis, ScanMode mode = ScanMode::inclusive)
+        {
+            impl::AxisSplit split(dimension::stridedShape(src.layout()), axis);
+
+            impl::scan(nullptr, &*src.ptr(), split, dst, op, mode);
+        }
+    }
+}
+
+#endif //MA_ALGORITHM_SCAN_H
@@ -0,0 +1,183 @@
+#ifndef MA_ALGORITHM_STREAM_COPY_H
+#define MA_ALGORITHM_STREAM_COPY_H
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+#include <ma_api/config.h>
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+namespace ma
+{
+    namespace algorithm
+    {
+        /**
+         * Number of bytes from which copies and fills bypass the cache with
+         * non temporal stores. Set it to the maximum of SizeT to disable them.
+         **/
+        inline SizeT & streamingThreshold() noexcept
+        {
+            static SizeT threshold(SizeT(1) << 24);
+            return threshold;
+        }
+
+        template<typename T>
+        bool useStreaming(SizeT size) noexcept
+        {
+            return size * SizeT(sizeof(T)) >= streamingThreshold();
+        }
+
+        /**
+         * Tag selecting the non temporal version of the copy kernels
+         **/
+        struct Streaming {};
+
+        namespace impl
+        {
+            constexpr SizeT lineSize = 64;
+
+            // Distance of the source prefetch, in cache lines
+            constexpr SizeT prefetchLines = 8;
+
+            template<typename T>
+            using Streamable = std::integral_constant<bool, std::is_trivially_copyable<T>::value>;
+
+            inline SizeT misalignment(const void * ptr, SizeT alignment) noexcept
+            {
+                return SizeT(reinterpret_cast<std::uintptr_t>(ptr) % std::uintptr_t(alignment));
+            }
+
+        #if defined(__SSE2__)
+
+            // One cache line of 16 bytes stores from src to the aligned dst
+            inline void streamLine(char * dst, const char * src) noexcept
+            {
+                __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+                __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16));
+                __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 32));
+                __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 48));
+
+                _mm_stream_si128(reinterpret_cast<__m128i *>(dst), a);
+                _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 16), b);
+                _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 32), c);
+                _mm_stream_si128(reinterpret_cast<__m128i *>(dst + 48), d);
+            }
+
+            inline void streamBytes(char * dst, const char * src, SizeT bytes) noexcept
+            {
+                SizeT head(ma::min(bytes, (lineSize - misalignment(dst, lineSize)) % lineSize));
+
+                std::memcpy(dst, src, head);
+                dst += head; src += head; bytes -= head;
+
+                for(; bytes >= lineSize; bytes -= lineSize, dst += lineSize, src += lineSize)
+                {
+                    MA_PREFETCH_NTA(src + prefetchLines * lineSize);
+                    streamLine(dst, src);
+                }
+
+                std::memcpy(dst, src, bytes);
+            }
+
+            // pattern holds 16 bytes of repeated values, aligned on the first dst element
+            inline void streamPattern(char * dst, __m128i pattern, SizeT bytes) noexcept
+            {
+                for(; bytes >= 16; bytes -= 16, dst += 16)
+                    _mm_stream_si128(reinterpret_cast<__m128i *>(dst), pattern);
+
+                alignas(16) char tail[16];
+                _mm_store_si128(reinterpret_cast<__m128i *>(tail), pattern);
+                std::memcpy(dst, tail, bytes);
+            }
+
+            inline void streamFence() noexcept
+            {
+                _mm_sfence();
+            }
+
+        #else
+
+            inline void streamBytes(char * dst, const char * src, SizeT bytes) noexcept
+            {
+                std::memcpy(dst, src, bytes);
+            }
+
+            inline void streamFence() noexcept
+            {}
+
+        #endif
+
+            template<typename T>
+            void streamCopy(T * dst, const T * src, SizeT size, std::true_type) noexcept
+            {
+                streamBytes(reinterpret_cast<char *>(dst), reinterpret_cast<const char *>(src), size * SizeT(sizeof(T)));
+            }
+
+            template<typename T>
+            void streamCopy(T * dst, const T * src, SizeT size, std::false_type)
+            {
+                ma::copy_n(src, size, dst);
+            }
+
+            template<typename T>
+            void streamFill(T * dst, const T & val, SizeT size, std::true_type) noexcept
+            {
+            #if defined(__SSE2__)
+                constexpr SizeT valSize(sizeof(T));
+
+                // The pattern needs whole values in 16 bytes, starting on an aligned address
+                if(16 % valSize == 0 && misalignment(dst, valSize) == 0)
+                {
+                    SizeT head(ma::min(size, (16 - misalignment(dst, 16)) % 16 / valSize));
+
+                    ma::fill_n(dst, head, val);
+                    dst += head; size -= head;
+
+                    alignas(16) char bytes[16];
+                    for(SizeT i(0); i < 16; i += valSize)
+                        std::memcpy(bytes + i, &val, valSize);
+
+                    streamPattern(reinterpret_cast<char *>(dst), _mm_load_si128(reinterpret_cast<const __m128i *>(bytes)), size * valSize);
+                    return;
+                }
+            #endif
+                ma::fill_n(dst, size, val);
+            }
+
+            template<typename T>
+            void streamFill(T * dst, const T & val, SizeT size, std::false_type)
+            {
+                ma::fill_n(dst, size, val);
+            }
+        }
+
+        /**
+         * Copy and fill with non temporal stores, for data that will not be
+         * read soon. The stores are only ordered with the other ones after
+         * streamFence(), called once at the end of a sequence of calls.
+         **/
+        template<typename T>
+        void streamCopy(T * dst, const T * src, SizeT size)
+        {
+            impl::streamCopy(dst, src, size, impl::Streamable<T>());
+        }
+
+        template<typename T>
+        void streamFill(T * dst, const T & val, SizeT size)
+        {
+            impl::streamFill(dst, val, size, impl::Streamable<T>());
+        }
+
+        inline void streamFence() noexcept
+        {
+            impl::streamFence();
+        }
+    }
+}
+
+#endif //MA_ALGORITHM_STREAM_COPY_H
@@ -0,0 +1,249 @@
+#ifndef MA_ALGORITHM_TAKE_H
+#define MA_ALGORITHM_TAKE_H
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+#include <ma_api/config.h>
+#include <ma_api/type.h>
+#include <ma_api/traits.h>
+#include <ma_api/function.h>
+
+#include <ma_api/dimension/StridedShape.h>
+
+namespace ma
+{
+    namespace algorithm
+    {
+        namespace impl
+        {
+            /**
+             * Number of indices read ahead to prefetch the selected elements
+             **/
+            constexpr SizeT prefetchDistance = 16;
+
+            /**
+             * Split a shape around axis : outer dimensions, selected axis and
+             * inner dimensions, all offsets relative to the first element
+             **/
+            struct AxisSplit
+            {
+                dimension::StridedShape outer;
+                dimension::StridedShape inner;
+                SizeT length;
+                SizeT stride;
+
+                AxisSplit(const dimension::StridedShape & shape, SizeT axis) :
+                    outer(select(shape, 0, axis)),
+                    inner(select(shape, axis + 1, shape.ndim())),
+                    length(shape.extent(axis)),
+                    stride(shape.stride(axis))
+                {
+                    massert(axis < shape.ndim());
+                }
+
+                static dimension::StridedShape select(const dimension::StridedShape & shape, SizeT first, SizeT last)
+                {
+                    VectRange extents(shape.shape()), strides(shape.strides());
+
+                    return dimension::StridedShape(
+                        VectRange(extents.begin() + first, extents.begin() + last),
+                        VectRange(strides.begin() + first, strides.begin() + last)
+                    );
+                }
+            };
+
+            template<typename T>
+            void gatherStrided(T * dst, const T * src, const SizeT * indices, SizeT nb, SizeT stride, SizeT first = 0)
+            {
+                for(SizeT i(first); i < nb; ++i)
+                {
+                    if(i + prefetchDistance < nb)
+                        MA_PREFETCH(src + indices[i + prefetchDistance] * stride);
+
+                    dst[i] = src[indices[i] * stride];
+                }
+            }
+
+            template<typename T>
+            void gatherUnit(T * dst, const T * src, const SizeT * indices, SizeT nb, std::false_type)
+            {
+                gatherStrided(dst, src, indices, nb, 1);
+            }
+
+            // Trivial element of 4 or 8 bytes : hardware gather by 4
+            template<typename T>
+            void gatherUnit(T * dst, const T * src, const SizeT * indices, SizeT nb, std::true_type)
+            {
+                SizeT i(0);
+
+            #ifdef __AVX2__
+                for(; i + 4 <= nb; i += 4)
+                {
+                    if(i + prefetchDistance < nb)
+                        MA_PREFETCH(src + indices[i + prefetchDistance]);
+
+                    __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+
+                    if(sizeof(T) == 8)
+                        _mm256_storeu_si256(
+                            reinterpret_cast<__m256i *>(dst + i),
+                            _mm256_i64gather_epi64(reinterpret_cast<const long long *>(src), idx, 8)
+                        );
+                    else
+                        _mm_storeu_si128(
+                            reinterpret_cast<__m128i *>(dst + i),
+                            _mm256_i64gather_epi32(reinterpret_cast<const int *>(src), idx, 4)
+                        );
+                }
+            #endif
+
+                gatherStrided(dst, src, indices, nb, 1, i);
+            }
+
+            template<typename T>
+            using IsGatherable = std::integral_constant<bool,
+                std::is_trivially_copyable<T>::value && (sizeof(T) == 4 || sizeof(T) == 8)
+            >;
+
+            /**
+             * dst[i] = src[indices[i] * stride]
+             **/
+            template<typename T>
+            void gather(T * dst, const T * src, const SizeT * indices, SizeT nb, SizeT stride)
+            {
+                if(stride == 1)
+                    gatherUnit(dst, src, indices, nb, IsGatherable<T>());
+                else
+                    gatherStrided(dst, src, indices, nb, stride);
+            }
+
+            /**
+             * dst[indices[i] * stride] = src[i], the last value wins for repeated indices
+             **/
+            template<typename T>
+            void scatter(T * dst, const T * src, const SizeT * indices, SizeT nb, SizeT stride)
+            {
+                for(SizeT i(0); i < nb; ++i)
+                {
+                    if(i + prefetchDistance < nb)
+                        MA_PREFETCH(dst + indices[i + prefetchDistance] * stride);
+
+                    dst[indices[i] * stride] = src[i];
+                }
+            }
+
+            // Sub array pointed by base to a dense buffer
+            template<typename T>
+            void packInner(T * dst, const T * base, const dimension::StridedShape & inner)
+            {
+                if(inner.contiguous())
+                    ma::copy_n(base, inner.size(), dst);
+                else
+                    for(SizeT pos(0); pos < inner.size(); ++pos)
+                        dst[pos] = base[inner.at(pos)];
+            }
+
+            template<typename T>
+            void unpackInner(T * base, const T * src, const dimension::StridedShape & inner)
+            {
+                if(inner.contiguous())
+                    ma::copy_n(src, inner.size(), base);
+                else
+                    for(SizeT pos(0); pos < inner.size(); ++pos)
+                        base[inner.at(pos)] = src[pos];
+            }
+
+            inline void checkIndices(const VectRange & indices, SizeT length)
+            {
+                for(auto index : indices)
+                {
+                    massert(index >= 0 && index < length);
+                    (void)index; (void)length;
+                }
+            }
+        }
+
+        /**
+         * Copy the sub arrays of src at indices along axis to the dense buffer dst,
+         * which must hold ma::size(indices) times the size of one sub array.
+         * The result has the shape of src with the extent of axis set to ma::size(indices).
+         **/
+        template<typename View>
+        void take(const View & src, const VectRange & indices, SizeT axis, typename View::value_type * dst)
+        {
+            using T = typename View::value_type;
+
+            impl::AxisSplit split(dimension::stridedShape(src.layout()), axis);
+            impl::checkIndices(indices, split.length);
+
+            const T * base(src.ptr());
+            SizeT nb(ma::size(indices)), innerSize(split.inner.size());
+
+            for(SizeT o(0); o < split.outer.size(); ++o)
+            {
+                const T * plane(base + split.outer.at(o));
+
+                if(split.inner.ndim() == 0)
+                {
+                    impl::gather(dst, plane, indices.data(), nb, split.stride);
+                    dst += nb;
+                }
+                else
+                    for(SizeT i(0); i < nb; ++i)
+                    {
+                        impl::packInner(dst, plane + indices[i] * split.stride, split.inner);
+                        dst += innerSize;
+                    }
+            }
+        }
+
+        /**
+         * Reverse of take : write the dense buffer values to the sub arrays of dst
+         * at indices along axis
+         **/
+        template<typename View>
+        void put(View & dst, const VectRange & indices, const typename View::value_type * values, SizeT axis)
+        {
+            using T = typename View::value_type;
+
+            impl::AxisSplit split(dimension::stridedShape(dst.layout()), axis);
+            impl::checkIndices(indices, split.length);
+
+            T * base(dst.ptr());
+            SizeT nb(ma::size(indices)), innerSize(split.inner.size());
+
+            for(SizeT o(0); o < split.outer.size(); ++o)
+            {
+                T * plane(base + split.outer.at(o));
+
+                if(split.inner.ndim() == 0)
+                {
+                    impl::scatter(plane, values, indices.data(), nb, split.stride);
+                    values += nb;
+                }
+                else
+                    for(SizeT i(0); i < nb; ++i)
+                    {
+                        impl::unpackInner(plane + indices[i] * split.stride, values, split.inner);
+                        values += innerSize;
+                    }
+            }
+        }
+
+        /**
+         * Shape of the result of take
+         **/
+        template<typename View>
+        VectRange takeShape(const View & src, const VectRange & indices, SizeT axis)
+        {
+            VectRange shape(src.shape());
+            shape[axis] = ma::size(indices);
+
+            return shape;
+        }
+    }
+}
+
+#endif //MA_ALGORITHM_TAKE_H
@@ -17,19 +17,33 @@ namespace ma
             using value_type = T;
             using allocator_type = typename Container::allocator_type;
 
+            template<typename, typename, typename> friend class Array;
+
         protected:
             Container container_;
 
+            // Share the data of container with a new shape
+            Array(const Container & container, Shape && shape, typename View::pointer ptr) :
+                View(move(shape), ptr), container_(container)
+            {}
+
             template<typename L>
             constexpr Array(Container && container, L && l) noexcept(noexcept(View(std::forward<L>(l), container.data()))) :
                 View(std::forward<L>(l), container.data()), container_(std::move(container))
             {}
 
         public:
+            template<typename S = Shape, typename = IsNotStaticShape<S>>
             constexpr explicit Array(const allocator_type& allocator = allocator_type()) noexcept :
                 View(), container_(allocator)
             {}
 
+            // Shape fully known at compile time : allocate directly
+            template<typename S = Shape, typename = IsStaticShape<S>, typename = void>
+            explicit Array(const allocator_type& allocator = allocator_type()) noexcept :
+                Array(Container(S().size(), allocator), S())
+            {}
+
             template<typename L, typename = IsNotEquivalent<L, allocator_type>, typename = IsNotEquivalent<L, View>, typename = IsNotEquivalent<L, Array>>
             explicit Array(L && l, const allocator_type& allocator = allocator_type()) noexcept :
                 Array(Container(sizeOf(l), allocator), forward<L>(l))
@@ -40,14 +54,27 @@ namespace ma
                 Array(Container(sizeOf(l), allocator), l)
             {}
 
-            template<typename L, typename Data, typename = IsNotEquivalent<Data, Array>, typename = IsNotEquivalent<L, Container>, typename = IsNotEquivalent<Data, allocator_type>>
+            /**
+             * Elements set to zero, see Container(size, zeros)
+             **/
+            template<typename L, typename = IsNotEquivalent<L, Container>>
+            explicit Array(L && l, Zeros, const allocator_type& allocator = allocator_type()) :
+                Array(Container(sizeOf(l), zeros, allocator), forward<L>(l))
+            {}
+
+            template<typename L>
+            explicit Array(const initializer_list<L> & l, Zeros, const allocator_type& allocator = allocator_type()) :
+                Array(Container(sizeOf(l), zeros, allocator), l)
+            {}
+
+            template<typename L, typename Data, typename = IsNotEquivalent<Data, Array>, typename = IsNotEquivalent<L, Container>, typename = IsNotEquivalent<Data, allocator_type>, typename = IsNotEquivalent<Data, Zeros>>
             explicit Array(L && l, Data && data, const allocator_type& allocator = allocator_type()) noexcept :
                 Array(Container(sizeOf(l), allocator), forward<L>(l))
             {
                 View::setMem(std::forward<Data>(data));
             }
 
-            template<typename L, typename Data, typename = IsNotEquivalent<Data, allocator_type>>
+            template<typename L, typename Data, typename = IsNotEquivalent<Data, allocator_type>, typename = IsNotEquivalent<Data, Zeros>>
             explicit Array(const initializer_list<L> & l, Data && data, const allocator_type& allocator = allocator_type()) noexcept :
                 Array(Container(sizeOf(l), allocator), l)
             {
@@ -90,6 +117,23 @@ namespace ma
                 return container_.size();
             }
 
+            /**
+             * Sub array keeping the data alive, only for containers sharing their data
+             **/
+            template<typename C = Container, typename = IsSharedContainer<C>, typename... R>
+            Array<T, Container, typename View::template SubShape<R...>> subArray(R && ... ranges) const
+            {
+                return Array<T, Container, typename View::template SubShape<R...>>(
+                    container_, View::shape_.subShape(forward<R>(ranges)...), View::ptr_
+                );
+            }
+
+            template<typename R, typename C = Container, typename = IsSharedContainer<C>>
+            Array subArrayAt(SizeT dim, R && range) const
+            {
+                return Array(container_, View::shape_.selectAt(dim, forward<R>(range)), View::ptr_);
+            }
+
             using View::size;
         };
     }
@@ -7,6 +7,7 @@
 #include <ma_api/function.h>
 #include <ma_api/printData.h>
 
+#include <ma_api/dimension/StridedShape.h>
 #include <ma_api/iterator/ShapeIterator.h>
 #include <ma_api/algorithm/copy.h>
 
@@ -40,6 +41,16 @@ namespace ma
             using const_iterator = iterator::ShapeIterator<const_pointer, Shape>;
             using iterator = iterator::ShapeIterator<pointer, Shape>;
 
+            using shape_type = Shape;
+
+            template<typename NShape>
+            using Rebind = ArrayView<T, Allocator, NShape>;
+
+            template<typename... R>
+            using SubShape = decay_t<decltype(std::declval<const Shape &>().subShape(std::declval<R>()...))>;
+
+            using CloseShape = decay_t<decltype(std::declval<const Shape &>().closeAt(SizeT()))>;
+
         protected:
             Shape shape_;
             pointer ptr_;
@@ -59,29 +70,72 @@ namespace ma
                 shape_(size), ptr_(ptr)
             {}
 
+            constexpr explicit ArrayView(Shape && shape, pointer ptr) noexcept :
+                shape_(move(shape)), ptr_(ptr)
+            {}
+
             ArrayView(const ArrayView &) = default;
             constexpr ArrayView(ArrayView &&) noexcept = default;
             
             ArrayView& operator=(const ArrayView &) = default;
             ArrayView& operator=(ArrayView &&) noexcept = default;
 
-        protected:
-            constexpr explicit ArrayView(Shape && shape, pointer ptr) noexcept :
-                shape_(move(shape)), ptr_(ptr)
-            {}
-
-        public:
             ~ArrayView() = default;
 
             template<typename... R>
-            ArrayView at(R&&...ranges) const
+            Rebind<SubShape<R...>> at(R&&...ranges) const
             {
-                return ArrayView(shape_.subShape(forward<R>(ranges)...), ptr_);
+                return Rebind<SubShape<R...>>(shape_.subShape(forward<R>(ranges)...), ptr_);
             }
 
-            ArrayView operator[](SizeT pos) const
+            Rebind<CloseShape> operator[](SizeT pos) const
             {
-                return ArrayView(shape_.closeAt(pos), ptr_);
+                return Rebind<CloseShape>(shape_.closeAt(pos), ptr_);
+            }
+
+            template<typename R>
+            ArrayView selectAt(SizeT dim, R && range) const
+            {
+                return ArrayView(shape_.selectAt(dim, forward<R>(range)), ptr_);
+            }
+
+            /**
+             * Same view described with explicit strides
+             **/
+            Rebind<dimension::StridedShape> strided() const
+            {
+                return Rebind<dimension::StridedShape>(dimension::stridedShape(shape_), ptr_);
+            }
+
+            /**
+             * View repeating the data along the dimensions of one element and
+             * along new leading dimensions, without copy
+             **/
+            Rebind<dimension::StridedShape> broadcastTo(const VectRange & shape) const
+            {
+                return Rebind<dimension::StridedShape>(dimension::broadcastTo(shape_, shape), ptr_);
+            }
+
+            /**
+             * View of all the windows of windowShape elements, moving by step.
+             * view[i][j] of a 2 dimensions view is the window starting at (i * step, j * step).
+             **/
+            Rebind<dimension::StridedShape> windows(const VectRange & windowShape, SizeT step = 1) const
+            {
+                return Rebind<dimension::StridedShape>(dimension::windows(shape_, windowShape, step), ptr_);
+            }
+
+            /**
+             * Same data seen with other extents, throws if a copy would be needed
+             **/
+            Rebind<dimension::StridedShape> reshape(const VectRange & shape) const
+            {
+                return Rebind<dimension::StridedShape>(dimension::stridedShape(shape_).reshape(shape), ptr_);
+            }
+
+            Rebind<dimension::StridedShape> flatten() const
+            {
+                return reshape(VectRange(1, size()));
             }
 
             iterator begin()
@@ -149,6 +203,16 @@ namespace ma
                 return shape_.ndim();
             }
 
+            VectRange strides() const
+            {
+                return shape_.strides();
+            }
+
+            constexpr const Shape & layout() const noexcept
+            {
+                return shape_;
+            }
+
             constexpr bool contiguous() const noexcept
             {
                 return shape_.contiguous();
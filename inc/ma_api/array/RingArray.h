@@ -0,0 +1,142 @@
+#ifndef MA_ARRAY_RING_ARRAY_H
+#define MA_ARRAY_RING_ARRAY_H
+
+#include <utility>
+
+#include <ma_api/array/Array.h>
+#include <ma_api/dimension/MultiShape.h>
+#include <ma_api/dimension/RingShape.h>
+#include <ma_api/range/LinearRange.h>
+
+namespace ma
+{
+    namespace array
+    {
+        /**
+         * Rolling history of frames. Pushing a frame overwrites the oldest slot
+         * and moves the head, nothing else is moved in memory.
+         **/
+        template <typename T, typename Container>
+        class RingArray
+        {
+        public:
+            using value_type = T;
+            using allocator_type = typename Container::allocator_type;
+
+            using Storage = Array<T, Container, dimension::MultiShape<range::LinearRange>>;
+            using FrameView = ArrayView<T, allocator_type, dimension::MultiShape<range::LinearRange>>;
+            using RingView = ArrayView<T, allocator_type, dimension::RingShape>;
+            using SegmentView = ArrayView<T, allocator_type, dimension::StridedShape>;
+            using ConstSegmentView = ArrayView<const T,
+                typename allocator_traits<allocator_type>::template rebind_alloc<const T>, dimension::StridedShape>;
+
+        protected:
+            Storage storage_;
+            VectRange frame_;
+            SizeT head_;
+            SizeT filled_;
+
+        public:
+            explicit RingArray(SizeT history, const VectRange & frameShape, const allocator_type& allocator = allocator_type()) :
+                storage_(withHistory(history, frameShape), allocator), frame_(frameShape), head_(0), filled_(0)
+            {}
+
+            SizeT history() const noexcept
+            {
+                return ma::size(storage_) / ma::max(frameSize(), SizeT(1));
+            }
+
+            /**
+             * Number of frames pushed, up to history
+             **/
+            SizeT filled() const noexcept
+            {
+                return filled_;
+            }
+
+            SizeT frameSize() const noexcept
+            {
+                return accumulate(ma::begin(frame_), ma::end(frame_), SizeT(1), std::multiplies<SizeT>());
+            }
+
+            /**
+             * Slot written by the next push, to fill in place before advance()
+             **/
+            FrameView nextFrame()
+            {
+                return storage_[head_];
+            }
+
+            void advance() noexcept
+            {
+                head_ = (head_ + 1 == history()) ? 0 : head_ + 1;
+                filled_ = ma::min(filled_ + 1, history());
+            }
+
+            template<typename Data>
+            void push(const Data & frame)
+            {
+                auto slot = nextFrame();
+                slot.setMem(frame);
+
+                advance();
+            }
+
+            /**
+             * The n last frames, oldest first
+             **/
+            RingView latest(SizeT n)
+            {
+                massert(n <= filled_);
+
+                return RingView(dimension::RingShape(history(), firstOf(n), n, frame_), storage_.ptr());
+            }
+
+            RingView latest()
+            {
+                return latest(filled_);
+            }
+
+            /**
+             * The n last frames as at most two contiguous views, oldest first
+             **/
+            std::pair<SegmentView, SegmentView> segments(SizeT n)
+            {
+                return segmentsOf<SegmentView>(n, storage_.ptr());
+            }
+
+            std::pair<ConstSegmentView, ConstSegmentView> segments(SizeT n) const
+            {
+                return segmentsOf<ConstSegmentView>(n, storage_.ptr());
+            }
+
+        protected:
+            SizeT firstOf(SizeT n) const noexcept
+            {
+                return (head_ + history() - n) % ma::max(history(), SizeT(1));
+            }
+
+            template<typename View, typename Ptr>
+            std::pair<View, View> segmentsOf(SizeT n, Ptr ptr) const
+            {
+                auto seg = dimension::RingShape(history(), firstOf(n), n, frame_).segments();
+                auto all = dimension::stridedShape(storage_.layout());
+
+                return {
+                    View(all.selectAt(0, range::LinearRange(seg.first.first, seg.first.first + seg.first.second)), ptr),
+                    View(all.selectAt(0, range::LinearRange(seg.second.first, seg.second.first + seg.second.second)), ptr)
+                };
+            }
+
+            static VectRange withHistory(SizeT history, const VectRange & frameShape)
+            {
+                VectRange shape(1, history);
+                shape.insert(shape.end(), frameShape.begin(), frameShape.end());
+
+                return shape;
+            }
+        };
+    }
+}
+
+#endif //MA_ARRAY_RING_ARRAY_H
@@ -20,6 +20,7 @@
 #endif
 
 
+#define MA_CXX20 (__cplusplus >= 202002L)
 #define MA_CXX17 (__cplusplus >= 201703L)
 #define MA_CXX14 (__cplusplus >= 201402L && ! MA_CXX17)
 
@@ -38,6 +39,42 @@
 #define MAYBE_UNUSED
 #endif
 
+/**
+ * Hint that address will be read soon, nothing on unknown compilers.
+ * NTA : read once, keep it out of the cache hierarchy as much as possible
+ **/
+#if defined(__GNUC__) || defined(__clang__)
+#define MA_PREFETCH(address) __builtin_prefetch(address)
+#define MA_PREFETCH_NTA(address) __builtin_prefetch(address, 0, 0)
+#else
+#define MA_PREFETCH(address)
+#define MA_PREFETCH_NTA(address)
+#endif
+
+/**
+ * Keep a rarely taken path out of the caller, as is on unknown compilers
+ **/
+#if defined(__GNUC__) || defined(__clang__)
+#define MA_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define MA_NOINLINE __declspec(noinline)
+#else
+#define MA_NOINLINE
+#endif
+
+/**
+ * co_await support, needs both the language feature and the library header
+ **/
+#if MA_CXX20 && defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define MA_COROUTINE 1
+#endif
+#endif
+
+#ifndef MA_COROUTINE
+#define MA_COROUTINE 0
+#endif
+
 #define LIGHTVARIANT
 
 #endif //MA_CONFIG_H
\ No newline at end of file
@@ -1,8 +1,10 @@
 #ifndef MA_CONTAINER_CONTAINER_H
 #define MA_CONTAINER_CONTAINER_H
 
+#include <cstdlib> //calloc & free
 #include <iostream> //allocator_traits
 #include <memory> //allocator_traits
+#include <new> //bad_alloc
 
 #include <ma_api/type.h>
 #include <ma_api/traits.h>
@@ -12,6 +14,17 @@ namespace ma
 {
     namespace container
     {
+        /**
+         * True when zero elements can come from calloc instead of the allocator :
+         * the default allocator, with types whose zero value is all bits at 0
+         **/
+        template<typename T, typename Allocator>
+        using CanCalloc = std::integral_constant<bool,
+            std::is_same<Allocator, std::allocator<T>>::value &&
+            std::is_arithmetic<T>::value &&
+            alignof(T) <= alignof(std::max_align_t)
+        >;
+
         template<typename T, typename Allocator = DefaultAlloc<T>>
         class Container {
         public:
@@ -40,21 +53,66 @@ namespace ma
             pointer pointer_;
             size_type size_;
 
+            /**
+             * Release of pointer_ : blocks from calloc never go through the
+             * allocator, they are given back by their own deleter
+             **/
+            using Release = void (*)(allocator_type &, pointer, size_type);
+
+            Release release_;
+
+            static void deallocate(allocator_type & allocator, pointer ptr, size_type size)
+            {
+                allocator.deallocate(ptr, size);
+            }
+
+            static void freeZeros(allocator_type &, pointer ptr, size_type)
+            {
+                std::free(ptr);
+            }
+
+            static pointer allocateZeros(allocator_type &, size_type size, Release & release, std::true_type)
+            {
+                void * ptr(std::calloc(ma::max(size, size_type(1)), sizeof(T)));
+
+                if(!ptr) throw std::bad_alloc();
+
+                release = &freeZeros;
+                return static_cast<pointer>(ptr);
+            }
+
+            static pointer allocateZeros(allocator_type & allocator, size_type size, Release &, std::false_type)
+            {
+                pointer ptr(allocator.allocate(size));
+                ma::fill_n(ptr, size, T());
+                return ptr;
+            }
+
         public:
             constexpr explicit Container(const allocator_type& allocator = Allocator()) noexcept :
-                allocator_(allocator), pointer_(nullptr), size_(0)
+                allocator_(allocator), pointer_(nullptr), size_(0), release_(&deallocate)
             {}
 
             constexpr explicit Container(size_type size, const allocator_type& allocator = Allocator()):
-                allocator_(allocator), pointer_(allocator_.allocate(size)), size_(size)
+                allocator_(allocator), pointer_(allocator_.allocate(size)), size_(size), release_(&deallocate)
             {}
 
+            /**
+             * Elements set to zero. With calloc, large blocks are mapped pages
+             * the OS provides already zeroed, each page costs only when touched.
+             **/
+            Container(size_type size, Zeros, const allocator_type& allocator = Allocator()):
+                allocator_(allocator), pointer_(nullptr), size_(size), release_(&deallocate)
+            {
+                pointer_ = allocateZeros(allocator_, size, release_, CanCalloc<T, Allocator>());
+            }
+
             constexpr Container(const Container & oc) :
-                allocator_(oc.allocator_), pointer_(allocator_.allocate(oc.size_)), size_(oc.size_)
+                allocator_(oc.allocator_), pointer_(allocator_.allocate(oc.size_)), size_(oc.size_), release_(&deallocate)
             {}
 
             constexpr Container(Container && oc) noexcept :
-                allocator_(std::move(oc.allocator_)), pointer_(exchange(oc.pointer_, pointer((value_type*)nullptr))), size_(oc.size_)
+                allocator_(std::move(oc.allocator_)), pointer_(exchange(oc.pointer_, pointer((value_type*)nullptr))), size_(oc.size_), release_(oc.release_)
             {}
 
             Container & operator=(const Container & oc)
@@ -63,6 +121,7 @@ namespace ma
 
                 allocator_ = oc.allocator_;
                 size_ = oc.size_;
+                release_ = &deallocate;
 
                 pointer_ = allocator_.allocate(size_);
 
@@ -71,8 +130,13 @@ namespace ma
 
             Container & operator=(Container && oc) noexcept
             {
+                if(this == &oc) return *this;
+
+                reset();
+
                 allocator_ = std::move(oc.allocator_);
                 size_ = oc.size_;
+                release_ = oc.release_;
 
                 pointer_ = exchange(oc.pointer_, pointer(nullptr));
 
@@ -86,8 +150,10 @@ namespace ma
 
             void reset()
             {
-                if(ptrValid(pointer_))
-                    allocator_.deallocate(pointer_, size_);
+                if(!ptrValid(pointer_))
+                    return;
+
+                release_(allocator_, pointer_, size_);
             }
 
             pointer data() noexcept { return pointer_; }
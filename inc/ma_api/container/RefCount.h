@@ -0,0 +1,137 @@
+#ifndef MA_CONTAINER_REF_COUNT_H
+#define MA_CONTAINER_REF_COUNT_H
+
+#include <memory> // shared_ptr & make_shared
+
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+namespace ma
+{
+    namespace container
+    {
+        /**
+         * Ownership through std::shared_ptr, copies can be made from any thread
+         **/
+        struct AtomicRefCount
+        {
+            template<typename C>
+            using Handle = std::shared_ptr<C>;
+
+            template<typename C, typename... Args>
+            static Handle<C> make(Args && ... args)
+            {
+                return std::make_shared<C>(forward<Args>(args)...);
+            }
+        };
+
+        /**
+         * Intrusive count allocated in the same block as the container header.
+         * Copies are plain increments, so every copy of a handle must stay on
+         * the same thread.
+         **/
+        struct LocalRefCount
+        {
+            template<typename C>
+            class Handle
+            {
+                struct Block
+                {
+                    SizeT count;
+                    C container;
+
+                    template<typename... Args>
+                    explicit Block(Args && ... args) :
+                        count(1), container(forward<Args>(args)...)
+                    {}
+                };
+
+                Block * block_;
+
+                friend struct LocalRefCount;
+
+                explicit Handle(Block * block) noexcept :
+                    block_(block)
+                {}
+
+            public:
+                constexpr Handle() noexcept :
+                    block_(nullptr)
+                {}
+
+                Handle(const Handle & oh) noexcept :
+                    block_(oh.block_)
+                {
+                    if(block_) ++block_->count;
+                }
+
+                Handle(Handle && oh) noexcept :
+                    block_(exchange(oh.block_, nullptr))
+                {}
+
+                // The new block is acquired before the old one is released
+                Handle & operator=(const Handle & oh) noexcept
+                {
+                    if(oh.block_) ++oh.block_->count;
+                    release(exchange(block_, oh.block_));
+                    return *this;
+                }
+
+                Handle & operator=(Handle && oh) noexcept
+                {
+                    release(exchange(block_, exchange(oh.block_, nullptr)));
+                    return *this;
+                }
+
+                ~Handle()
+                {
+                    release(block_);
+                }
+
+                C * get() const noexcept
+                {
+                    return block_ ? &block_->container : nullptr;
+                }
+
+                C * operator->() const noexcept
+                {
+                    return &block_->container;
+                }
+
+                C & operator*() const noexcept
+                {
+                    return block_->container;
+                }
+
+                SizeT use_count() const noexcept
+                {
+                    return block_ ? block_->count : 0;
+                }
+
+            private:
+                static void release(Block * block) noexcept
+                {
+                    if(block && --block->count == 0)
+                        destroy(block);
+                }
+
+                /**
+                 * Out of line : once inlined next to reads through other
+                 * handles of the block, gcc -O2 reports them as uses after free
+                 **/
+                MA_NOINLINE static void destroy(Block * block) noexcept
+                {
+                    delete block;
+                }
+            };
+
+            template<typename C, typename... Args>
+            static Handle<C> make(Args && ... args)
+            {
+                return Handle<C>(new typename Handle<C>::Block(forward<Args>(args)...));
+            }
+        };
+    }
+}
+
+#endif //MA_CONTAINER_REF_COUNT_H
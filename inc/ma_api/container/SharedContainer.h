@@ -1,15 +1,17 @@
 #ifndef MA_CONTAINER_SHARED_CONTAINER_H
 #define MA_CONTAINER_SHARED_CONTAINER_H
 
-#include <memory> // shared_ptr & make_shared
-
 #include <ma_api/container/Container.h>
+#include <ma_api/container/RefCount.h>
 
 namespace ma
 {
     namespace container
     {
-        template<typename T, typename Allocator = DefaultAlloc<T>, typename Container = Container<T, Allocator>>
+        /**
+         * Container shared by reference count, RefCount selects how the count is kept
+         **/
+        template<typename T, typename Allocator = DefaultAlloc<T>, typename Container = Container<T, Allocator>, typename RefCount = AtomicRefCount>
         class SharedContainer {
         public:
             using value_type     = T;
@@ -29,18 +31,23 @@ namespace ma
             using propagate_on_container_move_assignment = typename allocator_trait::propagate_on_container_move_assignment;
             using propagate_on_container_swap            = typename allocator_trait::propagate_on_container_swap;
 
-            using shared_container = std::shared_ptr<container_type>;
+            using ref_count = RefCount;
+            using shared_container = typename RefCount::template Handle<container_type>;
 
         protected:
             shared_container container_;
 
         public:
             constexpr explicit SharedContainer(const Allocator& allocator = Allocator()) noexcept :
-                container_(std::make_shared<container_type>(allocator))
+                container_(RefCount::template make<container_type>(allocator))
             {}
 
             constexpr explicit SharedContainer(size_type size, const Allocator& allocator = Allocator()):
-                container_(std::make_shared<container_type>(size, allocator))
+                container_(RefCount::template make<container_type>(size, allocator))
+            {}
+
+            SharedContainer(size_type size, Zeros, const Allocator& allocator = Allocator()):
+                container_(RefCount::template make<container_type>(size, zeros, allocator))
             {}
 
             constexpr SharedContainer(const SharedContainer&) noexcept = default;
@@ -62,6 +69,11 @@ namespace ma
 
             constexpr size_type size() const noexcept { return container_->size(); }
             constexpr allocator_type get_allocator() const { return container_->get_allocator(); }
+
+            /**
+             * Number of SharedContainer sharing the data
+             **/
+            SizeT use_count() const noexcept { return container_.use_count(); }
         };
     }
 }
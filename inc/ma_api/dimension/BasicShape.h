@@ -109,6 +109,16 @@ namespace ma
                 return 1;
             }
 
+            VectRange strides() const
+            {
+                return VectRange(1, 1);
+            }
+
+            constexpr SizeT baseOffset() const noexcept
+            {
+                return start_;
+            }
+
         };
     }
 }
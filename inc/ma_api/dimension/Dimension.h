@@ -101,6 +101,11 @@ namespace ma
                 return range_.active();
             }
 
+            constexpr DiffT step() const noexcept
+            {
+                return range_.step();
+            }
+
             constexpr SizeT rangedElementNb() const noexcept
             {
                 return ma::max(range_.rangedElementNb(), SizeT(1));
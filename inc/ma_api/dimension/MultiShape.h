@@ -61,6 +61,12 @@ namespace ma
                 return MultiShape(selectDimensions(dims_, pos));
             }
 
+            template<typename R>
+            MultiShape selectAt(SizeT dim, R && range) const
+            {
+                return MultiShape(selectDimensionAt(dims_, dim, forward<R>(range)));
+            }
+
             
             SizeT at(SizeT pos) const noexcept
             {
@@ -209,6 +215,25 @@ namespace ma
             //     return baseShape(nbDim());
             // }
 
+            /**
+             * Distance in elements between two consecutive indices of each active dimension
+             **/
+            VectRange strides() const
+            {
+                VectRange strides(activeDimNb());
+
+                SizeT baseStride(1), activeDim(strides.size());
+                for(SizeT dim(dimNb()); dim-- > 0;)
+                {
+                    if(dims_[dim].active())
+                        strides[--activeDim] = baseStride * dims_[dim].step();
+
+                    baseStride *= baseSizeAt(dim);
+                }
+
+                return strides;
+            }
+
             VectRange shape(SizeT dimNbMax) const
             {
                 VectRange shape(dimNbMax);
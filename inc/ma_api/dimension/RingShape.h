@@ -0,0 +1,119 @@
+#ifndef MA_DIMENSION_RING_SHAPE_H
+#define MA_DIMENSION_RING_SHAPE_H
+
+#include <utility>
+
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+#include <ma_api/range/LinearRange.h>
+#include <ma_api/dimension/StridedShape.h>
+
+namespace ma
+{
+    namespace dimension
+    {
+        /**
+         * Consecutive frames of a ring of length dense frames. The first dimension
+         * wraps modulo length, starting at slot first. Frames stay contiguous, so
+         * copies go frame by frame, or in at most two segments with segments().
+         **/
+        class RingShape
+        {
+        protected:
+            SizeT length_;
+            SizeT first_;
+            SizeT count_;
+            VectRange frame_;
+            SizeT frameSize_;
+
+        public:
+            explicit RingShape(SizeT length, SizeT first, SizeT count, VectRange frame) :
+                length_(length), first_(first), count_(count), frame_(move(frame)),
+                frameSize_(accumulate(ma::begin(frame_), ma::end(frame_), SizeT(1), std::multiplies<SizeT>()))
+            {
+                massert(count_ <= length_ && first_ < ma::max(length_, SizeT(1)));
+            }
+
+            RingShape(const RingShape &) = default;
+            RingShape(RingShape &&) noexcept = default;
+
+            RingShape& operator=(const RingShape &) = default;
+            RingShape& operator=(RingShape &&) noexcept = default;
+
+            SizeT slotAt(SizeT frame) const noexcept
+            {
+                SizeT slot(first_ + frame);
+                return (slot < length_) ? slot : slot - length_;
+            }
+
+            SizeT at(SizeT pos) const noexcept
+            {
+                return slotAt(pos / frameSize_) * frameSize_ + pos % frameSize_;
+            }
+
+            SizeT size() const noexcept
+            {
+                return count_ * frameSize_;
+            }
+
+            bool contiguous() const noexcept
+            {
+                return first_ + count_ <= length_;
+            }
+
+            SizeT step() const noexcept
+            {
+                return contiguous() ? size() : frameSize_;
+            }
+
+            SizeT ndim() const noexcept
+            {
+                return 1 + frame_.size();
+            }
+
+            VectRange shape() const
+            {
+                VectRange shape(1, count_);
+                shape.insert(shape.end(), frame_.begin(), frame_.end());
+
+                return shape;
+            }
+
+            SizeT baseOffset() const noexcept
+            {
+                return at(0);
+            }
+
+            /**
+             * Slot range [first, first + count) of the two contiguous segments,
+             * the second one is empty when the frames don't wrap
+             **/
+            std::pair<std::pair<SizeT, SizeT>, std::pair<SizeT, SizeT>> segments() const noexcept
+            {
+                SizeT head(ma::min(count_, length_ - first_));
+
+                return { {first_, head}, {0, count_ - head} };
+            }
+
+            /**
+             * Select consecutive frames in time order, the frames themselves are kept whole
+             **/
+            template<typename... R>
+            RingShape subShape(const range::LinearRange & frames, R && ...) const
+            {
+                static_assert(sizeof...(R) == 0, "Only the frame dimension of a ring can be ranged");
+                massert(frames.step() == 1 && frames.start() + frames.size() <= count_);
+
+                return RingShape(length_, slotAt(frames.start()), frames.size(), frame_);
+            }
+
+            StridedShape closeAt(SizeT pos) const
+            {
+                return StridedShape(frame_, StridedShape::denseStrides(frame_), slotAt(pos) * frameSize_);
+            }
+        };
+    }
+}
+
+#endif //MA_DIMENSION_RING_SHAPE_H
@@ -0,0 +1,311 @@
+#ifndef MA_DIMENSION_STATIC_SHAPE_H
+#define MA_DIMENSION_STATIC_SHAPE_H
+
+#include <utility> // index_sequence
+
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+#include <ma_api/range/LinearRange.h>
+#include <ma_api/dimension/MultiShape.h>
+
+namespace ma
+{
+    namespace dimension
+    {
+        /**
+         * Extent value that is only known at runtime
+         **/
+        constexpr SizeT dynamicExtent = -1;
+
+        namespace impl
+        {
+            template<SizeT... E> struct Extents;
+
+            template<>
+            struct Extents<>
+            {
+                static constexpr SizeT dynamicNb = 0;
+                static constexpr SizeT staticSize = 1;
+
+                static constexpr SizeT at(SizeT) noexcept { return 0; }
+                static constexpr SizeT dynamicBefore(SizeT) noexcept { return 0; }
+            };
+
+            template<SizeT Head, SizeT... Tail>
+            struct Extents<Head, Tail...>
+            {
+                using Next = Extents<Tail...>;
+
+                static constexpr SizeT dynamicNb = (Head == dynamicExtent) + Next::dynamicNb;
+                static constexpr SizeT staticSize = ((Head == dynamicExtent) ? 1 : Head) * Next::staticSize;
+
+                /**
+                 * Static extent of dimension dim, dynamicExtent if only known at runtime
+                 **/
+                static constexpr SizeT at(SizeT dim) noexcept
+                {
+                    return (dim == 0) ? Head : Next::at(dim - 1);
+                }
+
+                /**
+                 * Number of dynamic extents before dimension dim
+                 **/
+                static constexpr SizeT dynamicBefore(SizeT dim) noexcept
+                {
+                    return (dim == 0) ? 0 : (Head == dynamicExtent) + Next::dynamicBefore(dim - 1);
+                }
+            };
+
+            template<SizeT... E>
+            struct TailShape;
+        }
+
+        /**
+         * Shape with extents known at compile time. Extents set to dynamicExtent
+         * are given at construction. The shape is always complete and contiguous,
+         * so offset computation reduces to an addition and size folds to a constant
+         * when all extents are static.
+         **/
+        template<SizeT... Extents>
+        class StaticShape
+        {
+            using ExtentsT = impl::Extents<Extents...>;
+
+            template<SizeT...> friend class StaticShape;
+
+        public:
+            static constexpr SizeT rank = sizeof...(Extents);
+            static constexpr SizeT dynamicRank = ExtentsT::dynamicNb;
+            static constexpr bool isStatic = dynamicRank == 0;
+
+            using DynamicExtents = ArrayRange<dynamicRank>;
+
+        protected:
+            DynamicExtents dynamics_;
+            SizeT offset_;
+
+        public:
+            constexpr StaticShape() noexcept :
+                dynamics_(), offset_(0)
+            {}
+
+            template<typename L, typename = IsIntegral<L>>
+            explicit StaticShape(L length) noexcept :
+                dynamics_(), offset_(0)
+            {
+                static_assert(rank == 1, "Only one dimension shape can be initialized with a length");
+
+                setExtent(0, length);
+            }
+
+            template<typename L, typename = IsIterable<L>, typename = IsNotEquivalent<L, StaticShape>>
+            explicit StaticShape(const L & lengths) noexcept :
+                dynamics_(), offset_(0)
+            {
+                massert(ma::size(lengths) == rank);
+
+                SizeT dim(0);
+                for(auto length : lengths)
+                    setExtent(dim++, length);
+            }
+
+            template<typename L, std::size_t N>
+            explicit StaticShape(const L (&lengths)[N]) noexcept :
+                dynamics_(), offset_(0)
+            {
+                static_assert(N == rank, "Lengths number doesn't fit static shape rank");
+
+                for(SizeT dim(0); dim < rank; ++dim)
+                    setExtent(dim, lengths[dim]);
+            }
+
+            constexpr StaticShape(const StaticShape &) noexcept = default;
+            StaticShape & operator=(const StaticShape &) noexcept = default;
+
+        protected:
+            constexpr explicit StaticShape(const DynamicExtents & dynamics, SizeT offset) noexcept :
+                dynamics_(dynamics), offset_(offset)
+            {}
+
+            void setExtent(SizeT dim, SizeT length) noexcept
+            {
+                if(ExtentsT::at(dim) == dynamicExtent)
+                {
+                    dynamics_[ExtentsT::dynamicBefore(dim)] = length;
+                }
+                else
+                {
+                    massert(ExtentsT::at(dim) == length);
+                }
+            }
+
+            template<typename Tail, std::size_t... I>
+            constexpr typename Tail::DynamicExtents dropFirst(std::index_sequence<I...>) const noexcept
+            {
+                return typename Tail::DynamicExtents{{dynamics_[I + 1]...}};
+            }
+
+            // First extent is dynamic : drop it
+            template<typename Tail>
+            constexpr typename Tail::DynamicExtents tailDynamics(std::true_type) const noexcept
+            {
+                return dropFirst<Tail>(std::make_index_sequence<Tail::dynamicRank>());
+            }
+
+            template<typename Tail>
+            constexpr typename Tail::DynamicExtents tailDynamics(std::false_type) const noexcept
+            {
+                return dynamics_;
+            }
+
+            constexpr SizeT sizeFrom(SizeT dim) const noexcept
+            {
+                return (dim == rank) ? 1 : extent(dim) * sizeFrom(dim + 1);
+            }
+
+        public:
+            constexpr SizeT extent(SizeT dim) const noexcept
+            {
+                return (ExtentsT::at(dim) == dynamicExtent)
+                    ? dynamics_[ExtentsT::dynamicBefore(dim)]
+                    : ExtentsT::at(dim);
+            }
+
+            static constexpr SizeT staticExtent(SizeT dim) noexcept
+            {
+                return ExtentsT::at(dim);
+            }
+
+            constexpr SizeT at(SizeT pos) const noexcept
+            {
+                return offset_ + pos;
+            }
+
+            constexpr SizeT size() const noexcept
+            {
+                return isStatic ? ExtentsT::staticSize : sizeFrom(0);
+            }
+
+            constexpr SizeT baseSize() const noexcept
+            {
+                return size();
+            }
+
+            constexpr SizeT step() const noexcept
+            {
+                return size();
+            }
+
+            constexpr bool contiguous() const noexcept
+            {
+                return true;
+            }
+
+            constexpr SizeT baseOffset() const noexcept
+            {
+                return offset_;
+            }
+
+            constexpr SizeT ndim() const noexcept
+            {
+                return rank;
+            }
+
+            VectRange shape() const
+            {
+                VectRange shape(rank);
+
+                for(SizeT dim(0); dim < rank; ++dim)
+                    shape[dim] = extent(dim);
+
+                return shape;
+            }
+
+            VectRange strides() const
+            {
+                VectRange strides(rank);
+
+                SizeT stride(1);
+                for(SizeT dim(rank); dim-- > 0;)
+                {
+                    strides[dim] = stride;
+                    stride *= extent(dim);
+                }
+
+                return strides;
+            }
+
+            /**
+             * Remove the first dimension, the result keeps all the remaining extents static
+             **/
+            constexpr typename impl::TailShape<Extents...>::type closeAt(SizeT pos) const noexcept
+            {
+                using Tail = typename impl::TailShape<Extents...>::type;
+
+                return Tail(
+                    tailDynamics<Tail>(std::integral_constant<bool, staticExtent(0) == dynamicExtent>()),
+                    offset_ + pos * sizeFrom(1)
+                );
+            }
+
+            /**
+             * Equivalent runtime shape, used when selecting arbitrary ranges
+             **/
+            MultiShape<range::LinearRange> multiShape() const
+            {
+                SizeT innerSize(size());
+
+                if(offset_ == 0 || innerSize == 0)
+                    return MultiShape<range::LinearRange>(shape());
+
+                // Restore the outer dimension closed to reach the offset
+                SizeT outer(offset_ / innerSize);
+
+                VectRange lengths(1, outer + 1);
+                VectRange inner(shape());
+                lengths.insert(lengths.end(), inner.begin(), inner.end());
+
+                return MultiShape<range::LinearRange>(lengths).closeAt(outer);
+            }
+
+            template<typename... R>
+            MultiShape<range::LinearRange> subShape(R && ... ranges) const
+            {
+                return multiShape().subShape(forward<R>(ranges)...);
+            }
+        };
+
+        template<SizeT... Extents>
+        constexpr SizeT StaticShape<Extents...>::rank;
+
+        template<SizeT... Extents>
+        constexpr SizeT StaticShape<Extents...>::dynamicRank;
+
+        template<SizeT... Extents>
+        constexpr bool StaticShape<Extents...>::isStatic;
+
+        namespace impl
+        {
+            template<>
+            struct TailShape<>
+            {
+                using type = StaticShape<>;
+            };
+
+            template<SizeT Head, SizeT... Tail>
+            struct TailShape<Head, Tail...>
+            {
+                using type = StaticShape<Tail...>;
+            };
+        }
+
+        template<SizeT... Extents>
+        constexpr SizeT sizeOf(const StaticShape<Extents...> & shape) noexcept
+        {
+            return shape.size();
+        }
+    }
+}
+
+#endif //MA_DIMENSION_STATIC_SHAPE_H
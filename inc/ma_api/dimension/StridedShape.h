@@ -0,0 +1,387 @@
+#ifndef MA_DIMENSION_STRIDED_SHAPE_H
+#define MA_DIMENSION_STRIDED_SHAPE_H
+
+#include <stdexcept>
+
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+#include <ma_api/range/LinearRange.h>
+#include <ma_api/range/rangeFunction.h>
+
+namespace ma
+{
+    namespace dimension
+    {
+        /**
+         * Shape described by an explicit stride per dimension, like a strided
+         * mdspan mapping or a NumPy buffer. Strides are expressed in elements
+         * and may be any value, dimensions are not required to be nested.
+         **/
+        class StridedShape
+        {
+        protected:
+            VectRange extents_;
+            VectRange strides_;
+            SizeT offset_;
+
+        public:
+            explicit StridedShape() :
+                extents_(1, 0), strides_(1, 1), offset_(0)
+            {}
+
+            template<typename L, typename = IsIntegral<L>>
+            explicit StridedShape(L length) :
+                extents_(1, length), strides_(1, 1), offset_(0)
+            {}
+
+            template<typename L, typename = IsIterable<L>>
+            explicit StridedShape(const L & lengths) :
+                extents_(ma::begin(lengths), ma::end(lengths)), strides_(denseStrides(extents_)), offset_(0)
+            {}
+
+            template<typename L, std::size_t N >
+            explicit StridedShape(const L (&lengths)[N]) :
+                extents_(ma::begin(lengths), ma::end(lengths)), strides_(denseStrides(extents_)), offset_(0)
+            {}
+
+            explicit StridedShape(VectRange extents, VectRange strides, SizeT offset = 0) :
+                extents_(move(extents)), strides_(move(strides)), offset_(offset)
+            {
+                throwIfMismatch(ma::size(extents_), ma::size(strides_), "Extents and strides haven't the same size");
+            }
+
+            StridedShape(const StridedShape &) = default;
+            StridedShape(StridedShape &&) noexcept = default;
+
+            StridedShape& operator=(const StridedShape &) = default;
+            StridedShape& operator=(StridedShape &&) noexcept = default;
+
+            /**
+             * Row major strides of a dense array
+             **/
+            static VectRange denseStrides(const VectRange & extents)
+            {
+                VectRange strides(extents.size());
+
+                SizeT stride(1);
+                for(SizeT dim(strides.size()); dim-- > 0;)
+                {
+                    strides[dim] = stride;
+                    stride *= extents[dim];
+                }
+
+                return strides;
+            }
+
+            /**
+             * Memory offset of the element pos in row major order. An empty
+             * shape has no element, its position is the offset itself.
+             **/
+            SizeT at(SizeT pos) const noexcept
+            {
+                SizeT off(offset_);
+
+                for(SizeT dim(ndim()); dim-- > 0;)
+                {
+                    if(extents_[dim] == 0) return offset_;
+
+                    off += (pos % extents_[dim]) * strides_[dim];
+                    pos /= extents_[dim];
+                }
+
+                return off;
+            }
+
+            SizeT size() const noexcept
+            {
+                return accumulate(ma::begin(extents_), ma::end(extents_), SizeT(1), std::multiplies<SizeT>());
+            }
+
+            /**
+             * Number of elements contiguous in memory in the innermost dimensions
+             **/
+            SizeT step() const noexcept
+            {
+                SizeT cdl(1);
+
+                for(SizeT dim(ndim()); dim-- > 0;)
+                {
+                    // A dimension of one element doesn't break contiguity whatever its stride
+                    if(extents_[dim] == 1) continue;
+
+                    if(strides_[dim] != cdl) break;
+
+                    cdl *= extents_[dim];
+                }
+
+                return ma::max(cdl, SizeT(1));
+            }
+
+            bool contiguous() const noexcept
+            {
+                return step() == size();
+            }
+
+            SizeT ndim() const noexcept
+            {
+                return extents_.size();
+            }
+
+            VectRange shape() const
+            {
+                return extents_;
+            }
+
+            VectRange strides() const
+            {
+                return strides_;
+            }
+
+            SizeT extent(SizeT dim) const noexcept
+            {
+                return extents_[dim];
+            }
+
+            SizeT stride(SizeT dim) const noexcept
+            {
+                return strides_[dim];
+            }
+
+            SizeT baseOffset() const noexcept
+            {
+                return offset_;
+            }
+
+            StridedShape closeAt(SizeT pos) const
+            {
+                return StridedShape(
+                    VectRange(extents_.begin() + 1, extents_.end()),
+                    VectRange(strides_.begin() + 1, strides_.end()),
+                    offset_ + pos * strides_.front()
+                );
+            }
+
+            template<typename... R>
+            StridedShape subShape(R && ... ranges) const
+            {
+                StridedShape res(VectRange(), VectRange(), offset_);
+
+                res.selectFrom(*this, 0, forward<R>(ranges)...);
+
+                return res;
+            }
+
+            template<typename R>
+            StridedShape selectAt(SizeT dim, R && range) const
+            {
+                StridedShape res(
+                    VectRange(extents_.begin(), extents_.begin() + dim),
+                    VectRange(strides_.begin(), strides_.begin() + dim),
+                    offset_
+                );
+
+                res.selectFrom(*this, dim, forward<R>(range));
+
+                return res;
+            }
+
+            /**
+             * Stretch the shape to extents following NumPy rules : missing leading
+             * dimensions and dimensions of one element are repeated with a zero
+             * stride, so the data is never duplicated. Writing through the result
+             * writes several times to the same element.
+             **/
+            StridedShape broadcastTo(const VectRange & extents) const
+            {
+                if(SizeT(extents.size()) < ndim())
+                    throw std::length_error("Cannot broadcast to a shape with fewer dimensions");
+
+                SizeT lead(extents.size() - ndim());
+                VectRange strides(extents.size(), 0);
+
+                for(SizeT dim(0); dim < ndim(); ++dim)
+                {
+                    if(extents_[dim] == extents[lead + dim])
+                        strides[lead + dim] = strides_[dim];
+                    else if(extents_[dim] != 1)
+                        throw std::length_error("Only dimensions of one element can be broadcast");
+                }
+
+                return StridedShape(extents, move(strides), offset_);
+            }
+
+            /**
+             * Sliding windows of windowShape elements moving by step along each
+             * dimension. The result has twice the dimensions : window positions
+             * first, then the window content, both reusing the existing strides.
+             * Windows overlap, so elements are shared between them.
+             **/
+            StridedShape windows(const VectRange & windowShape, SizeT step = 1) const
+            {
+                throwIfMismatch(ma::size(windowShape), ndim(), "Window shape and shape haven't the same dimension number");
+                massert(step > 0);
+
+                VectRange extents(2 * ndim()), strides(2 * ndim());
+
+                for(SizeT dim(0); dim < ndim(); ++dim)
+                {
+                    if(windowShape[dim] > extents_[dim])
+                        throw std::length_error("Window larger than the shape");
+
+                    extents[dim] = (extents_[dim] - windowShape[dim]) / step + 1;
+                    strides[dim] = strides_[dim] * step;
+
+                    extents[ndim() + dim] = windowShape[dim];
+                    strides[ndim() + dim] = strides_[dim];
+                }
+
+                return StridedShape(move(extents), move(strides), offset_);
+            }
+
+            /**
+             * True if the data can be seen with the new extents without copy
+             **/
+            bool reshapeable(const VectRange & extents) const
+            {
+                VectRange strides;
+                return reshapeStrides(extents, strides);
+            }
+
+            /**
+             * Same elements in row major order with other extents. Throws when the
+             * layout doesn't allow it without copy, like a transposed array.
+             **/
+            StridedShape reshape(const VectRange & extents) const
+            {
+                VectRange strides;
+
+                if(!reshapeStrides(extents, strides))
+                    throw std::invalid_argument("Layout doesn't allow this reshape without copy");
+
+                return StridedShape(extents, move(strides), offset_);
+            }
+
+        protected:
+            /**
+             * Merge groups of old dimensions that have the same size as groups of
+             * new dimensions, each old group must be contiguous within itself.
+             **/
+            bool reshapeStrides(const VectRange & extents, VectRange & strides) const
+            {
+                SizeT newSize(accumulate(ma::begin(extents), ma::end(extents), SizeT(1), std::multiplies<SizeT>()));
+                throwIfMismatch(size(), newSize, "Reshape can't change the number of elements");
+
+                if(newSize == 0)
+                {
+                    strides = denseStrides(extents);
+                    return true;
+                }
+
+                // Dimensions of one element don't constrain the layout
+                VectRange oldExtents, oldStrides;
+                for(SizeT dim(0); dim < ndim(); ++dim)
+                    if(extents_[dim] != 1)
+                    {
+                        oldExtents.push_back(extents_[dim]);
+                        oldStrides.push_back(strides_[dim]);
+                    }
+
+                strides.assign(extents.size(), 1);
+
+                SizeT oi(0), oj(1), ni(0), nj(1);
+                while(ni < SizeT(extents.size()) && oi < SizeT(oldExtents.size()))
+                {
+                    SizeT np(extents[ni]), op(oldExtents[oi]);
+
+                    while(np != op)
+                    {
+                        if(np < op)
+                            np *= extents[nj++];
+                        else
+                            op *= oldExtents[oj++];
+                    }
+
+                    for(SizeT ok(oi); ok + 1 < oj; ++ok)
+                        if(oldStrides[ok] != oldExtents[ok + 1] * oldStrides[ok + 1])
+                            return false;
+
+                    strides[nj - 1] = oldStrides[oj - 1];
+                    for(SizeT nk(nj - 1); nk > ni; --nk)
+                        strides[nk - 1] = strides[nk] * extents[nk];
+
+                    ni = nj++;
+                    oi = oj++;
+                }
+
+                return true;
+            }
+
+            void push(SizeT extent, SizeT stride)
+            {
+                extents_.push_back(extent);
+                strides_.push_back(stride);
+            }
+
+            void selectFrom(const StridedShape & base, SizeT dim)
+            {
+                for(; dim < base.ndim(); ++dim)
+                    push(base.extents_[dim], base.strides_[dim]);
+            }
+
+            template<typename... Tail>
+            void selectFrom(const StridedShape & base, SizeT dim, const range::LinearRange & range, Tail && ... tail)
+            {
+                offset_ += range.start() * base.strides_[dim];
+                push(range.size(), base.strides_[dim] * range.step());
+
+                selectFrom(base, dim + 1, forward<Tail>(tail)...);
+            }
+
+            template<typename... Tail>
+            void selectFrom(const StridedShape & base, SizeT dim, const range::DelayLinearIndice & range, Tail && ... tail)
+            {
+                selectFrom(base, dim, range::LinearRange(range.begin, base.extents_[dim], range.step), forward<Tail>(tail)...);
+            }
+
+            template<typename... Tail>
+            void selectFrom(const StridedShape & base, SizeT dim, All, Tail && ... tail)
+            {
+                push(base.extents_[dim], base.strides_[dim]);
+
+                selectFrom(base, dim + 1, forward<Tail>(tail)...);
+            }
+
+            template<typename Pos, typename... Tail>
+            auto selectFrom(const StridedShape & base, SizeT dim, Pos pos, Tail && ... tail) -> IsIntegral<Pos>
+            {
+                offset_ += pos * base.strides_[dim];
+
+                selectFrom(base, dim + 1, forward<Tail>(tail)...);
+            }
+        };
+
+        /**
+         * Strided description of any shape exposing its strides
+         **/
+        template<typename Shape>
+        StridedShape stridedShape(const Shape & shape)
+        {
+            return StridedShape(shape.shape(), shape.strides(), shape.baseOffset());
+        }
+
+        template<typename Shape>
+        StridedShape windows(const Shape & shape, const VectRange & windowShape, SizeT step = 1)
+        {
+            return stridedShape(shape).windows(windowShape, step);
+        }
+
+        template<typename Shape>
+        StridedShape broadcastTo(const Shape & shape, const VectRange & extents)
+        {
+            return stridedShape(shape).broadcastTo(extents);
+        }
+    }
+}
+
+#endif //MA_DIMENSION_STRIDED_SHAPE_H
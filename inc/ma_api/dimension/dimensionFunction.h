@@ -135,6 +135,24 @@ namespace ma
             return nDims;
         }
 
+        /**
+         * Select range on the activeDim-th active dimension only
+         **/
+        template<typename Range, typename R>
+        VectDimension<Range> selectDimensionAt(const VectDimension<Range> & dims, SizeT activeDim, R && range)
+        {
+            VectDimension<Range> nDims(dims);
+
+            for(auto & dim : nDims)
+                if(dim.active() && activeDim-- == 0)
+                {
+                    dim = makeDim(dim, forward<R>(range));
+                    break;
+                }
+
+            return nDims;
+        }
+
 
 
 
@@ -327,6 +327,7 @@ namespace ma
      **/
     using std::copy;
     using std::copy_n;
+    using std::copy_backward;
     using std::fill;
     using std::fill_n;
 
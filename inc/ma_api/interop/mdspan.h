@@ -0,0 +1,178 @@
+#ifndef MA_INTEROP_MDSPAN_H
+#define MA_INTEROP_MDSPAN_H
+
+#include <array>
+#include <stdexcept>
+
+#include <ma_api/config.h>
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+#include <ma_api/dimension/MultiShape.h>
+#include <ma_api/dimension/StridedShape.h>
+#include <ma_api/array/ArrayView.h>
+
+/**
+ * Use the standard mdspan when available, else the reference implementation
+ **/
+#if defined(__has_include)
+    #if __has_include(<mdspan>) && __cplusplus > 202002L
+        #include <mdspan>
+        #define MA_MDSPAN_NS std
+    #elif __has_include(<experimental/mdspan>)
+        #include <experimental/mdspan>
+        #define MA_MDSPAN_NS std::experimental
+    #endif
+#endif
+
+#ifdef MA_MDSPAN_NS
+#define MA_HAS_MDSPAN
+
+namespace ma
+{
+    namespace interop
+    {
+        namespace md = MA_MDSPAN_NS;
+
+        template<std::size_t Rank>
+        using Extents = md::dextents<std::size_t, Rank>;
+
+        namespace impl
+        {
+            template<std::size_t Rank, typename Shape>
+            std::array<std::size_t, Rank> toArray(const Shape & shape, const VectRange & values)
+            {
+                throwIfMismatch(shape.ndim(), Rank, "Shape hasn't the mdspan rank");
+
+                std::array<std::size_t, Rank> res;
+
+                for(std::size_t dim(0); dim < Rank; ++dim)
+                {
+                    if(values[dim] < 0)
+                        throw std::invalid_argument("mdspan cannot represent a negative stride");
+
+                    res[dim] = values[dim];
+                }
+
+                return res;
+            }
+
+            /**
+             * layout_stride needs strides greater than 0 : broadcast views,
+             * which repeat elements with a 0 stride, must be copied first
+             **/
+            template<std::size_t Rank, typename Shape>
+            std::array<std::size_t, Rank> toStrides(const Shape & shape)
+            {
+                const VectRange & strides(shape.strides());
+
+                for(std::size_t dim(0); dim < ma::min(Rank, std::size_t(strides.size())); ++dim)
+                    if(strides[dim] == 0)
+                        throw std::invalid_argument("mdspan cannot represent a null stride, copy broadcast views first");
+
+                return toArray<Rank>(shape, strides);
+            }
+
+            template<typename Layout> struct MappingOf;
+
+            template<>
+            struct MappingOf<md::layout_right>
+            {
+                template<std::size_t Rank, typename Shape>
+                static typename md::layout_right::template mapping<Extents<Rank>> make(const Shape & shape)
+                {
+                    if(not contiguous(shape))
+                        throw std::invalid_argument("layout_right needs a contiguous view");
+
+                    return typename md::layout_right::template mapping<Extents<Rank>>(
+                        Extents<Rank>(toArray<Rank>(shape, shape.shape()))
+                    );
+                }
+            };
+
+            template<>
+            struct MappingOf<md::layout_stride>
+            {
+                template<std::size_t Rank, typename Shape>
+                static typename md::layout_stride::template mapping<Extents<Rank>> make(const Shape & shape)
+                {
+                    return typename md::layout_stride::template mapping<Extents<Rank>>(
+                        Extents<Rank>(toArray<Rank>(shape, shape.shape())),
+                        toStrides<Rank>(shape)
+                    );
+                }
+            };
+
+            template<typename Mapping>
+            VectRange extentsOf(const Mapping & mapping)
+            {
+                VectRange extents(Mapping::extents_type::rank());
+
+                for(std::size_t dim(0); dim < extents.size(); ++dim)
+                    extents[dim] = mapping.extents().extent(dim);
+
+                return extents;
+            }
+
+            template<typename Mapping>
+            VectRange stridesOf(const Mapping & mapping)
+            {
+                VectRange strides(Mapping::extents_type::rank());
+
+                for(std::size_t dim(0); dim < strides.size(); ++dim)
+                    strides[dim] = mapping.stride(dim);
+
+                return strides;
+            }
+        }
+
+        /**
+         * mdspan on the data of view without copy. Throw if the view rank isn't Rank
+         * or if its layout cannot be expressed with Layout, as for broadcast views.
+         **/
+        template<std::size_t Rank, typename Layout = md::layout_stride, typename T, typename Allocator, typename Shape>
+        md::mdspan<T, Extents<Rank>, Layout> toMdspan(array::ArrayView<T, Allocator, Shape> & view)
+        {
+            return md::mdspan<T, Extents<Rank>, Layout>(
+                view.ptr(), impl::MappingOf<Layout>::template make<Rank>(view.layout())
+            );
+        }
+
+        template<std::size_t Rank, typename Layout = md::layout_stride, typename T, typename Allocator, typename Shape>
+        md::mdspan<const T, Extents<Rank>, Layout> toMdspan(const array::ArrayView<T, Allocator, Shape> & view)
+        {
+            return md::mdspan<const T, Extents<Rank>, Layout>(
+                view.ptr(), impl::MappingOf<Layout>::template make<Rank>(view.layout())
+            );
+        }
+
+        /**
+         * View on the data of a row major mdspan without copy
+         **/
+        template<typename T, typename Ext, typename Accessor>
+        array::ArrayView<T, DefaultAlloc<T>, dimension::MultiShape<range::LinearRange>>
+        fromMdspan(const md::mdspan<T, Ext, md::layout_right, Accessor> & span)
+        {
+            return array::ArrayView<T, DefaultAlloc<T>, dimension::MultiShape<range::LinearRange>>(
+                impl::extentsOf(span.mapping()), span.data_handle()
+            );
+        }
+
+        /**
+         * View on the data of a strided mdspan without copy
+         **/
+        template<typename T, typename Ext, typename Accessor>
+        array::ArrayView<T, DefaultAlloc<T>, dimension::StridedShape>
+        fromMdspan(const md::mdspan<T, Ext, md::layout_stride, Accessor> & span)
+        {
+            return array::ArrayView<T, DefaultAlloc<T>, dimension::StridedShape>(
+                dimension::StridedShape(impl::extentsOf(span.mapping()), impl::stridesOf(span.mapping())),
+                span.data_handle()
+            );
+        }
+    }
+}
+
+#endif //MA_MDSPAN_NS
+
+#endif //MA_INTEROP_MDSPAN_H
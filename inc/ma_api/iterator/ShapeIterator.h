@@ -95,9 +95,15 @@ namespace ma
                 return ShapeIterator(iterator_, shape_, pos_ - pos);
             }
 
+            difference_type operator-(ShapeIterator const & si) const noexcept
+            {
+                return pos_ - si.pos_;
+            }
+
             bool equal(ShapeIterator const & si) const noexcept
             {
-                return pos_at(0) == si.pos_at(0);
+                // Offsets can repeat with broadcast or wrap at the end, positions can't
+                return pos_ == si.pos_;
             }
 
             bool operator==(ShapeIterator const & si) const noexcept
@@ -31,6 +31,11 @@ namespace ma
                 iterator_ += step_;
             }
 
+            void advance(SizeT blockNb) noexcept
+            {
+                iterator_ += step_ * blockNb;
+            }
+
             Iterator operator*() const
             {
                 return iterator_;
@@ -75,6 +80,9 @@ namespace ma
                 data_(data)
             {}
 
+            void advance(SizeT) noexcept
+            {}
+
             ConstIterator& operator++()
             {
                 return *this;
@@ -114,7 +122,7 @@ namespace ma
         template<typename Data, typename Res = IsIterable<Data, StepIterator<decltype(ma::begin(std::declval<Data&>()))>>>
         Res stepIterator(Data && d, SizeT step) noexcept
         {
-            return Res(ma::begin(forward<Data>(d)), step);
+            return Res(ma::begin(d), step);
         }
 
         // template<typename T, typename Data, typename StepIt = typename std::enable_if<std::is_same<T, typename std::iterator_traits<Data>::value_type>::value, StepIterator<Data>>::type>
@@ -124,12 +132,12 @@ namespace ma
         // }
 
         template<typename Data>
-        auto stepIterator(Data && d, SizeT step) noexcept -> IsPointer<Data, StepIterator<Data>>
+        auto stepIterator(Data && d, SizeT step) noexcept -> IsPointer<decay_t<Data>, StepIterator<decay_t<Data>>>
         {
-            return StepIterator<Data>(forward<Data>(d), step);
+            return StepIterator<decay_t<Data>>(d, step);
         }
 
-        template<typename Data, typename = IsNotIterable<Data>, typename Res = IsNotPointer<Data, ConstIterator<Data&>>>
+        template<typename Data, typename = IsNotIterable<Data>, typename Res = IsNotPointer<decay_t<Data>, ConstIterator<Data&>>>
         Res stepIterator(Data && d, SizeT) noexcept
         {
             return Res(forward<Data>(d));
@@ -0,0 +1,206 @@
+#ifndef MA_ITERATOR_TILE_ITERATOR_H
+#define MA_ITERATOR_TILE_ITERATOR_H
+
+#include <iterator>
+
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+#include <ma_api/range/LinearRange.h>
+#include <ma_api/dimension/StridedShape.h>
+
+namespace ma
+{
+    namespace iterator
+    {
+        enum class TileOrder{ rowMajor, morton };
+
+        template<typename TileRange>
+        class TileIterator
+        {
+        public:
+            using value_type        = typename TileRange::Tile;
+            using pointer           = void;
+            using reference         = value_type;
+            using difference_type   = DiffT;
+            using iterator_category = std::input_iterator_tag;
+
+        protected:
+            const TileRange * range_;
+            SizeT pos_;
+
+        public:
+            constexpr TileIterator(const TileRange & range, SizeT pos) noexcept :
+                range_(&range), pos_(pos)
+            {}
+
+            value_type operator*() const
+            {
+                return range_->at(pos_);
+            }
+
+            TileIterator& operator++() noexcept
+            {
+                ++pos_;
+                return *this;
+            }
+
+            TileIterator operator++(int) noexcept
+            {
+                return TileIterator(*range_, pos_++);
+            }
+
+            bool operator==(const TileIterator & ti) const noexcept
+            {
+                return pos_ == ti.pos_;
+            }
+
+            bool operator!=(const TileIterator & ti) const noexcept
+            {
+                return pos_ != ti.pos_;
+            }
+        };
+
+        /**
+         * Cut a view in tiles of tileShape elements, tiles on the upper edges are
+         * smaller. Tiles are sub views sharing the data, visited in row major
+         * order of the tile grid or in Morton (Z) order to keep neighbours close.
+         **/
+        template<typename View>
+        class TileRange
+        {
+        public:
+            using Tile = typename View::template Rebind<dimension::StridedShape>;
+            using iterator = TileIterator<TileRange>;
+            using const_iterator = iterator;
+
+        protected:
+            Tile view_;
+            VectRange tileShape_;
+            VectRange counts_;
+            SizeT size_;
+
+            // Tile grid indices in visit order, empty for row major
+            VectRange order_;
+
+        public:
+            TileRange(const View & view, const VectRange & tileShape, TileOrder order = TileOrder::rowMajor) :
+                view_(view.strided()), tileShape_(tileShape), counts_(tileShape.size()), size_(1), order_()
+            {
+                throwIfMismatch(ma::size(tileShape_), view_.ndim(), "Tile shape and view haven't the same dimension number");
+
+                for(SizeT dim(0); dim < view_.ndim(); ++dim)
+                {
+                    massert(tileShape_[dim] > 0);
+
+                    counts_[dim] = ceil(view_.layout().extent(dim), tileShape_[dim]);
+                    size_ *= counts_[dim];
+                }
+
+                if(order == TileOrder::morton)
+                    order_ = mortonOrder(counts_);
+            }
+
+            SizeT size() const noexcept
+            {
+                return size_;
+            }
+
+            /**
+             * Number of tiles along each dimension
+             **/
+            const VectRange & counts() const noexcept
+            {
+                return counts_;
+            }
+
+            /**
+             * Tile visited in position pos
+             **/
+            Tile at(SizeT pos) const
+            {
+                SizeT index(order_.empty() ? pos : order_[pos]);
+
+                Tile tile(view_);
+
+                for(SizeT dim(view_.ndim()); dim-- > 0;)
+                {
+                    SizeT start((index % counts_[dim]) * tileShape_[dim]);
+                    index /= counts_[dim];
+
+                    tile = tile.selectAt(dim, range::LinearRange(start, ma::min(start + tileShape_[dim], view_.layout().extent(dim))));
+                }
+
+                return tile;
+            }
+
+            iterator begin() const
+            {
+                return iterator(*this, 0);
+            }
+
+            iterator end() const
+            {
+                return iterator(*this, size_);
+            }
+
+            /**
+             * Row major indices of the grid cells sorted in Z order. Dimensions with
+             * fewer cells stop taking part in the interleaving once their bits are
+             * exhausted, so rectangular grids don't waste codes.
+             **/
+            static VectRange mortonOrder(const VectRange & counts)
+            {
+                SizeT ndim(ma::size(counts)), total(1), maxBits(0);
+                VectRange bits(ndim, 0);
+
+                for(SizeT dim(0); dim < ndim; ++dim)
+                {
+                    while((SizeT(1) << bits[dim]) < counts[dim]) ++bits[dim];
+
+                    total *= counts[dim];
+                    maxBits = ma::max(maxBits, bits[dim]);
+                }
+
+                SizeT codeBits(accumulate(bits.begin(), bits.end(), SizeT(0)));
+
+                VectRange order;
+                order.reserve(total);
+
+                VectRange coord(ndim);
+                for(SizeT code(0); code < (SizeT(1) << codeBits); ++code)
+                {
+                    std::fill(coord.begin(), coord.end(), 0);
+
+                    // Last dimension takes the lowest bit of each level
+                    SizeT shift(0);
+                    for(SizeT level(0); level < maxBits; ++level)
+                        for(SizeT dim(ndim); dim-- > 0;)
+                            if(level < bits[dim])
+                                coord[dim] |= ((code >> shift++) & 1) << level;
+
+                    SizeT index(0);
+                    bool inside(true);
+                    for(SizeT dim(0); dim < ndim; ++dim)
+                    {
+                        inside = inside && coord[dim] < counts[dim];
+                        index = index * counts[dim] + coord[dim];
+                    }
+
+                    if(inside)
+                        order.push_back(index);
+                }
+
+                return order;
+            }
+        };
+
+        template<typename View>
+        TileRange<View> tiles(const View & view, const VectRange & tileShape, TileOrder order = TileOrder::rowMajor)
+        {
+            return TileRange<View>(view, tileShape, order);
+        }
+    }
+}
+
+#endif //MA_ITERATOR_TILE_ITERATOR_H
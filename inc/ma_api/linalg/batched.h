@@ -0,0 +1,479 @@
+#ifndef MA_LINALG_BATCHED_H
+#define MA_LINALG_BATCHED_H
+
+#include <cmath>
+#include <atomic>
+#include <limits>
+
+#include <ma_api/linalg/gemm.h>
+
+namespace ma
+{
+    namespace linalg
+    {
+        namespace impl
+        {
+            /**
+             * Stack of small matrices along the leading axis : element (i, j)
+             * of matrix n at data[n * batchStride + i * rowStride + j * colStride].
+             * A batch stride of 0 repeats the same matrix for the whole batch.
+             **/
+            template<typename T>
+            struct Batch
+            {
+                T * data;
+                SizeT count, rows, cols;
+                SizeT batchStride, rowStride, colStride;
+
+                T * operator[](SizeT n) const noexcept
+                {
+                    return data + n * batchStride;
+                }
+
+                bool dense() const noexcept
+                {
+                    return (cols == 1 || colStride == 1) && (rows == 1 || rowStride == cols);
+                }
+            };
+
+            template<typename T>
+            using Element = typename std::remove_reference<T>::type;
+
+            /**
+             * {N, rows, cols} views, or a single {rows, cols} matrix used for
+             * every element of the batch
+             **/
+            template<typename View>
+            auto matrices(View & view) -> Batch<Element<decltype(*view.ptr())>>
+            {
+                VectRange shape(view.shape()), strides(view.strides());
+
+                if(view.ndim() == 2)
+                    return {&*view.ptr(), 1, shape[0], shape[1], 0, strides[0], strides[1]};
+
+                throwIfMismatch(view.ndim(), 3, "ERROR : a batch of matrices needs 2 or 3 dimensions");
+
+                return {&*view.ptr(), shape[0], shape[1], shape[2], shape[0] == 1 ? 0 : strides[0], strides[1], strides[2]};
+            }
+
+            /**
+             * {N, size} views, or a single vector used for every element of the
+             * batch. Vectors are seen as matrices of one column.
+             **/
+            template<typename View>
+            auto vectors(View & view) -> Batch<Element<decltype(*view.ptr())>>
+            {
+                VectRange shape(view.shape()), strides(view.strides());
+
+                if(view.ndim() == 1)
+                    return {&*view.ptr(), 1, shape[0], 1, 0, strides[0], 1};
+
+                throwIfMismatch(view.ndim(), 2, "ERROR : a batch of vectors needs 1 or 2 dimensions");
+
+                return {&*view.ptr(), shape[0], shape[1], 1, shape[0] == 1 ? 0 : strides[0], strides[1], 1};
+            }
+
+            template<typename T>
+            Batch<const T> constBatch(const Batch<T> & b) noexcept
+            {
+                return {b.data, b.count, b.rows, b.cols, b.batchStride, b.rowStride, b.colStride};
+            }
+
+            // Inputs of a single element are repeated, other counts must match the output
+            template<typename T, typename U>
+            void checkCount(const Batch<T> & in, const Batch<U> & out)
+            {
+                if(in.count != 1) throwIfMismatch(in.count, out.count, "ERROR : batch sizes differ");
+            }
+
+            // Batches per task of the thread pool
+            constexpr SizeT batchGrain = 256;
+
+            /**
+             * Sizes with register blocked kernels. The generic lambda receives
+             * the size as an integral_constant, 0 for the other sizes.
+             **/
+            template<typename Fn>
+            void dispatchSize(SizeT size, Fn && fn)
+            {
+                switch(size)
+                {
+                    case 2 : fn(std::integral_constant<SizeT, 2>()); break;
+                    case 3 : fn(std::integral_constant<SizeT, 3>()); break;
+                    case 4 : fn(std::integral_constant<SizeT, 4>()); break;
+                    case 8 : fn(std::integral_constant<SizeT, 8>()); break;
+                    default : fn(std::integral_constant<SizeT, 0>());
+                }
+            }
+
+            /**
+             * Dense data gets compile time strides, the copies to and from the
+             * local arrays are then fully unrolled
+             **/
+            template<bool Dense, SizeT R, SizeT C, typename T>
+            void load(T (&dst)[R][C], const T * src, SizeT rowStride, SizeT colStride) noexcept
+            {
+                for(SizeT i(0); i < R; ++i)
+                    for(SizeT j(0); j < C; ++j)
+                        dst[i][j] = Dense ? src[i * C + j] : src[i * rowStride + j * colStride];
+            }
+
+            template<bool Dense, SizeT R, SizeT C, typename T>
+            void store(const T (&src)[R][C], T * dst, SizeT rowStride, SizeT colStride) noexcept
+            {
+                for(SizeT i(0); i < R; ++i)
+                    for(SizeT j(0); j < C; ++j)
+                        (Dense ? dst[i * C + j] : dst[i * rowStride + j * colStride]) = src[i][j];
+            }
+
+            template<typename T, SizeT N, bool Dense>
+            void matmulFixed(const Batch<const T> & a, const Batch<const T> & b, const Batch<T> & c, SizeT first, SizeT last) noexcept
+            {
+                for(SizeT n(first); n < last; ++n)
+                {
+                    T x[N][N], y[N][N], z[N][N] = {};
+
+                    load<Dense>(x, a[n], a.rowStride, a.colStride);
+                    load<Dense>(y, b[n], b.rowStride, b.colStride);
+
+                    for(SizeT i(0); i < N; ++i)
+                        for(SizeT p(0); p < N; ++p)
+                            for(SizeT j(0); j < N; ++j)
+                                z[i][j] += x[i][p] * y[p][j];
+
+                    store<Dense>(z, c[n], c.rowStride, c.colStride);
+                }
+            }
+
+            template<typename T>
+            void matmulAny(const Batch<const T> & a, const Batch<const T> & b, const Batch<T> & c, SizeT first, SizeT last)
+            {
+                SizeT m(c.rows), k(a.cols), n(c.cols);
+                T * z(scratch<T, 2>(m * n));
+
+                for(SizeT s(first); s < last; ++s)
+                {
+                    const T * x(a[s]);
+                    const T * y(b[s]);
+                    T * out(c[s]);
+
+                    for(SizeT i(0); i < m; ++i)
+                        for(SizeT j(0); j < n; ++j)
+                        {
+                            T sum(0);
+                            for(SizeT p(0); p < k; ++p)
+                                sum += x[i * a.rowStride + p * a.colStride] * y[p * b.rowStride + j * b.colStride];
+                            z[i * n + j] = sum;
+                        }
+
+                    for(SizeT i(0); i < m; ++i)
+                        for(SizeT j(0); j < n; ++j)
+                            out[i * c.rowStride + j * c.colStride] = z[i * n + j];
+                }
+            }
+
+            template<typename T>
+            void batchedMatmul(parallel::ThreadPool * pool, const Batch<const T> & a, const Batch<const T> & b, const Batch<T> & c)
+            {
+                throwIfMismatch(a.cols, b.rows, "ERROR : inner dimensions of the product differ");
+                throwIfMismatch(a.rows, c.rows, "ERROR : rows of the product differ");
+                throwIfMismatch(b.cols, c.cols, "ERROR : columns of the product differ");
+                checkCount(a, c); checkCount(b, c);
+
+                bool square(a.rows == a.cols && b.rows == b.cols);
+                bool dense(a.dense() && b.dense() && c.dense());
+
+                dispatchSize(square ? c.rows : 0, [&](auto size)
+                {
+                    constexpr SizeT N(decltype(size)::value);
+
+                    forRange(pool, 0, c.count, batchGrain, [&](SizeT first, SizeT last)
+                    {
+                        if(N == 0)       matmulAny<T>(a, b, c, first, last);
+                        else if(dense)   matmulFixed<T, N ? N : 1, true>(a, b, c, first, last);
+                        else             matmulFixed<T, N ? N : 1, false>(a, b, c, first, last);
+                    });
+                });
+            }
+
+            template<typename T, SizeT N, bool Dense>
+            void matvecFixed(const Batch<const T> & a, const Batch<const T> & x, const Batch<T> & y, SizeT first, SizeT last) noexcept
+            {
+                for(SizeT n(first); n < last; ++n)
+                {
+                    T m[N][N], v[N][1], r[N][1] = {};
+
+                    load<Dense>(m, a[n], a.rowStride, a.colStride);
+                    load<Dense>(v, x[n], x.rowStride, x.colStride);
+
+                    for(SizeT i(0); i < N; ++i)
+                        for(SizeT j(0); j < N; ++j)
+                            r[i][0] += m[i][j] * v[j][0];
+
+                    store<Dense>(r, y[n], y.rowStride, y.colStride);
+                }
+            }
+
+            template<typename T>
+            void batchedMatvec(parallel::ThreadPool * pool, const Batch<const T> & a, const Batch<const T> & x, const Batch<T> & y)
+            {
+                throwIfMismatch(a.cols, x.rows, "ERROR : columns of the matrices and vector size differ");
+                throwIfMismatch(a.rows, y.rows, "ERROR : rows of the matrices and result size differ");
+                checkCount(a, y); checkCount(x, y);
+
+                bool dense(a.dense() && x.dense() && y.dense());
+
+                dispatchSize(a.rows == a.cols ? a.rows : 0, [&](auto size)
+                {
+                    constexpr SizeT N(decltype(size)::value);
+
+                    forRange(pool, 0, y.count, batchGrain, [&](SizeT first, SizeT last)
+                    {
+                        if(N == 0)       matmulAny<T>(a, x, y, first, last);
+                        else if(dense)   matvecFixed<T, N ? N : 1, true>(a, x, y, first, last);
+                        else             matvecFixed<T, N ? N : 1, false>(a, x, y, first, last);
+                    });
+                });
+            }
+
+            /**
+             * In place LU factorization with partial pivoting, row i of the
+             * factors holds row perm[i] of the matrix. False if singular.
+             **/
+            template<typename T, typename M, typename P>
+            bool factorize(M && lu, P && perm, SizeT n) noexcept
+            {
+                for(SizeT i(0); i < n; ++i) perm[i] = i;
+
+                for(SizeT k(0); k < n; ++k)
+                {
+                    SizeT pivot(k);
+                    for(SizeT i(k + 1); i < n; ++i)
+                        if(std::abs(lu(i, k)) > std::abs(lu(pivot, k))) pivot = i;
+
+                    if(lu(pivot, k) == T(0)) return false;
+
+                    if(pivot != k)
+                    {
+                        for(SizeT j(0); j < n; ++j) std::swap(lu(k, j), lu(pivot, j));
+                        std::swap(perm[k], perm[pivot]);
+                    }
+
+                    T inv(T(1) / lu(k, k));
+
+                    for(SizeT i(k + 1); i < n; ++i)
+                    {
+                        T f(lu(i, k) *= inv);
+                        for(SizeT j(k + 1); j < n; ++j)
+                            lu(i, j) -= f * lu(k, j);
+                    }
+                }
+
+                return true;
+            }
+
+            // Forward then backward substitution of the permuted rhs, in place in y
+            template<typename T, typename M, typename V>
+            void substitute(M && lu, V && y, SizeT n) noexcept
+            {
+                for(SizeT i(1); i < n; ++i)
+                    for(SizeT j(0); j < i; ++j)
+                        y[i] -= lu(i, j) * y[j];
+
+                for(SizeT i(n); i-- > 0;)
+                {
+                    for(SizeT j(i + 1); j < n; ++j)
+                        y[i] -= lu(i, j) * y[j];
+                    y[i] /= lu(i, i);
+                }
+            }
+
+            /**
+             * Solve a * x = b for each element of the batch, one factorization
+             * for all the columns of b. Singular systems give NaN solutions.
+             **/
+            template<typename T, SizeT N, bool Dense>
+            SizeT solveFixed(const Batch<const T> & a, const Batch<const T> & b, const Batch<T> & x, SizeT first, SizeT last) noexcept
+            {
+                SizeT singular(0);
+
+                for(SizeT n(first); n < last; ++n)
+                {
+                    T m[N][N];
+                    SizeT perm[N];
+
+                    load<Dense>(m, a[n], a.rowStride, a.colStride);
+
+                    bool regular(factorize<T>([&](SizeT i, SizeT j) -> T & { return m[i][j]; }, perm, N));
+                    singular += !regular;
+
+                    const T * rhs(b[n]);
+                    T * out(x[n]);
+
+                    for(SizeT r(0); r < x.cols; ++r)
+                    {
+                        T y[N];
+
+                        for(SizeT i(0); i < N; ++i)
+                            y[i] = regular ? rhs[perm[i] * b.rowStride + r * b.colStride] : std::numeric_limits<T>::quiet_NaN();
+
+                        if(regular)
+                            substitute<T>([&](SizeT i, SizeT j) -> T & { return m[i][j]; }, y, N);
+
+                        for(SizeT i(0); i < N; ++i)
+                            out[i * x.rowStride + r * x.colStride] = y[i];
+                    }
+                }
+
+                return singular;
+            }
+
+            template<typename T>
+            SizeT solveAny(const Batch<const T> & a, const Batch<const T> & b, const Batch<T> & x, SizeT first, SizeT last)
+            {
+                SizeT n(a.rows), singular(0);
+                T * m(scratch<T, 2>(n * n + n));
+                T * y(m + n * n);
+                SizeT * perm(scratch<SizeT, 3>(n));
+
+                auto lu = [&](SizeT i, SizeT j) -> T & { return m[i * n + j]; };
+
+                for(SizeT s(first); s < last; ++s)
+                {
+                    const T * src(a[s]);
+
+                    for(SizeT i(0); i < n; ++i)
+                        for(SizeT j(0); j < n; ++j)
+                            lu(i, j) = src[i * a.rowStride + j * a.colStride];
+
+                    bool regular(factorize<T>(lu, perm, n));
+                    singular += !regular;
+
+                    const T * rhs(b[s]);
+                    T * out(x[s]);
+
+                    for(SizeT r(0); r < x.cols; ++r)
+                    {
+                        for(SizeT i(0); i < n; ++i)
+                            y[i] = regular ? rhs[perm[i] * b.rowStride + r * b.colStride] : std::numeric_limits<T>::quiet_NaN();
+
+                        if(regular)
+                            substitute<T>(lu, y, n);
+
+                        for(SizeT i(0); i < n; ++i)
+                            out[i * x.rowStride + r * x.colStride] = y[i];
+                    }
+                }
+
+                return singular;
+            }
+
+            template<typename T>
+            SizeT batchedSolve(parallel::ThreadPool * pool, const Batch<const T> & a, const Batch<const T> & b, const Batch<T> & x)
+            {
+                static_assert(std::is_floating_point<T>::value, "batchedSolve needs floating point values");
+
+                throwIfMismatch(a.rows, a.cols, "ERROR : systems need square matrices");
+                throwIfMismatch(a.rows, b.rows, "ERROR : rows of the matrices and right hand side differ");
+                throwIfMismatch(b.rows, x.rows, "ERROR : rows of the right hand side and solution differ");
+                throwIfMismatch(b.cols, x.cols, "ERROR : columns of the right hand side and solution differ");
+                checkCount(a, x); checkCount(b, x);
+
+                std::atomic<SizeT> singular(0);
+
+                dispatchSize(a.rows, [&](auto size)
+                {
+                    constexpr SizeT N(decltype(size)::value);
+
+                    forRange(pool, 0, x.count, batchGrain, [&](SizeT first, SizeT last)
+                    {
+                        if(N == 0)           singular += solveAny<T>(a, b, x, first, last);
+                        else if(a.dense())   singular += solveFixed<T, N ? N : 1, true>(a, b, x, first, last);
+                        else                 singular += solveFixed<T, N ? N : 1, false>(a, b, x, first, last);
+                    });
+                });
+
+                return singular;
+            }
+        }
+
+        /**
+         * c[n] = a[n] * b[n] over the leading axis of {N, m, k}, {N, k, n} and
+         * {N, m, n} views. A 2 dimensions a or b is used for the whole batch.
+         * Square sizes 2, 3, 4 and 8 use unrolled kernels. c must not overlap
+         * a or b. The batch is split between the threads of pool, without
+         * pool it runs on the calling thread, as the other batched functions.
+         **/
+        template<typename A, typename B, typename C>
+        void batchedMatmul(parallel::ThreadPool & pool, const A & a, const B & b, C && c)
+        {
+            using T = ValueOf<C>;
+
+            impl::batchedMatmul<T>(&pool, impl::constBatch(impl::matrices(a)), impl::constBatch(impl::matrices(b)), impl::matrices(c));
+        }
+
+        template<typename A, typename B, typename C>
+        void batchedMatmul(const A & a, const B & b, C && c)
+        {
+            using T = ValueOf<C>;
+
+            impl::batchedMatmul<T>(nullptr, impl::constBatch(impl::matrices(a)), impl::constBatch(impl::matrices(b)), impl::matrices(c));
+        }
+
+        /**
+         * y[n] = a[n] * x[n], a of {N, m, k} and x, y of {N, k} and {N, m}.
+         * A single matrix transforms every vector, a single vector is
+         * transformed by every matrix.
+         **/
+        template<typename A, typename X, typename Y>
+        void batchedMatvec(parallel::ThreadPool & pool, const A & a, const X & x, Y && y)
+        {
+            using T = ValueOf<Y>;
+
+            impl::batchedMatvec<T>(&pool, impl::constBatch(impl::matrices(a)), impl::constBatch(impl::vectors(x)), impl::vectors(y));
+        }
+
+        template<typename A, typename X, typename Y>
+        void batchedMatvec(const A & a, const X & x, Y && y)
+        {
+            using T = ValueOf<Y>;
+
+            impl::batchedMatvec<T>(nullptr, impl::constBatch(impl::matrices(a)), impl::constBatch(impl::vectors(x)), impl::vectors(y));
+        }
+
+        namespace impl
+        {
+            // One or several right hand sides, depending on the dimensions of x
+            template<typename A, typename B, typename X>
+            SizeT batchedSolve(parallel::ThreadPool * pool, const A & a, const B & b, X && x)
+            {
+                using T = ValueOf<X>;
+
+                if(x.ndim() == 2 || x.ndim() == 1)
+                    return batchedSolve<T>(pool, constBatch(matrices(a)), constBatch(vectors(b)), vectors(x));
+
+                return batchedSolve<T>(pool, constBatch(matrices(a)), constBatch(matrices(b)), matrices(x));
+            }
+        }
+
+        /**
+         * Solve a[n] * x[n] = b[n] by LU factorization with partial pivoting,
+         * without forming the inverse. b and x are {N, k} for one right hand
+         * side or {N, k, r} for r of them. Returns the number of singular
+         * systems, their solutions are NaN.
+         **/
+        template<typename A, typename B, typename X>
+        SizeT batchedSolve(parallel::ThreadPool & pool, const A & a, const B & b, X && x)
+        {
+            return impl::batchedSolve(&pool, a, b, x);
+        }
+
+        template<typename A, typename B, typename X>
+        SizeT batchedSolve(const A & a, const B & b, X && x)
+        {
+            return impl::batchedSolve(nullptr, a, b, x);
+        }
+    }
+}
+
+#endif //MA_LINALG_BATCHED_H
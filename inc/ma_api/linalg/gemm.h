@@ -0,0 +1,584 @@
+#ifndef MA_LINALG_GEMM_H
+#define MA_LINALG_GEMM_H
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+#include <vector>
+
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+#include <ma_api/parallel/ThreadPool.h>
+
+namespace ma
+{
+    namespace linalg
+    {
+        namespace impl
+        {
+            /**
+             * Element (i, j) at data[i * rowStride + j * colStride], any strides
+             **/
+            template<typename T>
+            struct Matrix
+            {
+                T * data;
+                SizeT rows, cols;
+                SizeT rowStride, colStride;
+
+                T & operator()(SizeT i, SizeT j) const noexcept
+                {
+                    return data[i * rowStride + j * colStride];
+                }
+            };
+
+            template<typename T>
+            struct Vector
+            {
+                T * data;
+                SizeT size;
+                SizeT stride;
+
+                T & operator[](SizeT i) const noexcept
+                {
+                    return data[i * stride];
+                }
+            };
+
+            template<typename View>
+            auto matrix(View & view) -> Matrix<typename std::remove_reference<decltype(*view.ptr())>::type>
+            {
+                throwIfMismatch(view.ndim(), 2, "ERROR : a matrix needs 2 dimensions");
+
+                VectRange shape(view.shape()), strides(view.strides());
+
+                return {&*view.ptr(), shape[0], shape[1], strides[0], strides[1]};
+            }
+
+            template<typename View>
+            auto vector(View & view) -> Vector<typename std::remove_reference<decltype(*view.ptr())>::type>
+            {
+                throwIfMismatch(view.ndim(), 1, "ERROR : a vector needs 1 dimension");
+
+                return {&*view.ptr(), view.size(), view.strides()[0]};
+            }
+
+            // Scratch memory reused by the calls made on a thread
+            template<typename T, int Id>
+            T * scratch(SizeT size)
+            {
+                static thread_local std::vector<T> buffer;
+
+                if(SizeT(buffer.size()) < size)
+                    buffer.resize(size);
+
+                return buffer.data();
+            }
+
+            // beta == 0 does not read dst, which may hold uninitialized values
+            template<typename T>
+            void update(T & dst, T value, T alpha, T beta) noexcept
+            {
+                dst = (beta == T(0)) ? alpha * value : alpha * value + beta * dst;
+            }
+
+            /**
+             * Register blocking of the gemm : the micro kernel computes a tile of
+             * mr x nr elements from packed slivers of a (k x mr) and b (k x nr).
+             * mc x kc elements of a stay in L2, kc x nc of b in L3.
+             **/
+            template<typename T>
+            struct GemmKernel
+            {
+                static constexpr SizeT mr = 4, nr = 8, kc = 256, mc = 128, nc = 1024;
+
+                static void micro(SizeT k, const T * a, const T * b, T * tile) noexcept
+                {
+                    T acc[mr][nr] = {};
+
+                    for(SizeT p(0); p < k; ++p, a += mr, b += nr)
+                        for(SizeT i(0); i < mr; ++i)
+                            for(SizeT j(0); j < nr; ++j)
+                                acc[i][j] += a[i] * b[j];
+
+                    for(SizeT i(0); i < mr; ++i)
+                        for(SizeT j(0); j < nr; ++j)
+                            tile[i * nr + j] = acc[i][j];
+                }
+            };
+
+            template<typename T>
+            struct GemvKernel
+            {
+                static T dot(const T * a, const T * x, SizeT n) noexcept
+                {
+                    T s0(0), s1(0), s2(0), s3(0);
+                    SizeT j(0);
+
+                    for(; j + 4 <= n; j += 4)
+                    {
+                        s0 += a[j] * x[j];
+                        s1 += a[j + 1] * x[j + 1];
+                        s2 += a[j + 2] * x[j + 2];
+                        s3 += a[j + 3] * x[j + 3];
+                    }
+
+                    for(; j < n; ++j)
+                        s0 += a[j] * x[j];
+
+                    return (s0 + s1) + (s2 + s3);
+                }
+
+                // 4 rows at once, x is read once for all of them
+                static void dot4(const T * a, SizeT rowStride, const T * x, SizeT n, T * out) noexcept
+                {
+                    for(SizeT r(0); r < 4; ++r)
+                        out[r] = dot(a + r * rowStride, x, n);
+                }
+            };
+
+        #if defined(__AVX2__) && defined(__FMA__)
+
+            inline float hsum(__m256 v) noexcept
+            {
+                __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+                s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+                s = _mm_add_ss(s, _mm_movehdup_ps(s));
+                return _mm_cvtss_f32(s);
+            }
+
+            inline double hsum(__m256d v) noexcept
+            {
+                __m128d s = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+                return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+            }
+
+            template<>
+            struct GemmKernel<float>
+            {
+                static constexpr SizeT mr = 6, nr = 16, kc = 256, mc = 96, nc = 2048;
+
+                static void micro(SizeT k, const float * a, const float * b, float * tile) noexcept
+                {
+                    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+                    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+                    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+                    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+                    __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+                    __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+                    for(SizeT p(0); p < k; ++p, a += mr, b += nr)
+                    {
+                        __m256 b0 = _mm256_loadu_ps(b), b1 = _mm256_loadu_ps(b + 8), ai;
+
+                        ai = _mm256_broadcast_ss(a);     c00 = _mm256_fmadd_ps(ai, b0, c00); c01 = _mm256_fmadd_ps(ai, b1, c01);
+                        ai = _mm256_broadcast_ss(a + 1); c10 = _mm256_fmadd_ps(ai, b0, c10); c11 = _mm256_fmadd_ps(ai, b1, c11);
+                        ai = _mm256_broadcast_ss(a + 2); c20 = _mm256_fmadd_ps(ai, b0, c20); c21 = _mm256_fmadd_ps(ai, b1, c21);
+                        ai = _mm256_broadcast_ss(a + 3); c30 = _mm256_fmadd_ps(ai, b0, c30); c31 = _mm256_fmadd_ps(ai, b1, c31);
+                        ai = _mm256_broadcast_ss(a + 4); c40 = _mm256_fmadd_ps(ai, b0, c40); c41 = _mm256_fmadd_ps(ai, b1, c41);
+                        ai = _mm256_broadcast_ss(a + 5); c50 = _mm256_fmadd_ps(ai, b0, c50); c51 = _mm256_fmadd_ps(ai, b1, c51);
+                    }
+
+                    _mm256_storeu_ps(tile,       c00); _mm256_storeu_ps(tile + 8,  c01);
+                    _mm256_storeu_ps(tile + 16,  c10); _mm256_storeu_ps(tile + 24, c11);
+                    _mm256_storeu_ps(tile + 32,  c20); _mm256_storeu_ps(tile + 40, c21);
+                    _mm256_storeu_ps(tile + 48,  c30); _mm256_storeu_ps(tile + 56, c31);
+                    _mm256_storeu_ps(tile + 64,  c40); _mm256_storeu_ps(tile + 72, c41);
+                    _mm256_storeu_ps(tile + 80,  c50); _mm256_storeu_ps(tile + 88, c51);
+                }
+            };
+
+            template<>
+            struct GemmKernel<double>
+            {
+                static constexpr SizeT mr = 6, nr = 8, kc = 256, mc = 72, nc = 1024;
+
+                static void micro(SizeT k, const double * a, const double * b, double * tile) noexcept
+                {
+                    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+                    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+                    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+                    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+                    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+                    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+                    for(SizeT p(0); p < k; ++p, a += mr, b += nr)
+                    {
+                        __m256d b0 = _mm256_loadu_pd(b), b1 = _mm256_loadu_pd(b + 4), ai;
+
+                        ai = _mm256_broadcast_sd(a);     c00 = _mm256_fmadd_pd(ai, b0, c00); c01 = _mm256_fmadd_pd(ai, b1, c01);
+                        ai = _mm256_broadcast_sd(a + 1); c10 = _mm256_fmadd_pd(ai, b0, c10); c11 = _mm256_fmadd_pd(ai, b1, c11);
+                        ai = _mm256_broadcast_sd(a + 2); c20 = _mm256_fmadd_pd(ai, b0, c20); c21 = _mm256_fmadd_pd(ai, b1, c21);
+                        ai = _mm256_broadcast_sd(a + 3); c30 = _mm256_fmadd_pd(ai, b0, c30); c31 = _mm256_fmadd_pd(ai, b1, c31);
+                        ai = _mm256_broadcast_sd(a + 4); c40 = _mm256_fmadd_pd(ai, b0, c40); c41 = _mm256_fmadd_pd(ai, b1, c41);
+                        ai = _mm256_broadcast_sd(a + 5); c50 = _mm256_fmadd_pd(ai, b0, c50); c51 = _mm256_fmadd_pd(ai, b1, c51);
+                    }
+
+                    _mm256_storeu_pd(tile,      c00); _mm256_storeu_pd(tile + 4,  c01);
+                    _mm256_storeu_pd(tile + 8,  c10); _mm256_storeu_pd(tile + 12, c11);
+                    _mm256_storeu_pd(tile + 16, c20); _mm256_storeu_pd(tile + 20, c21);
+                    _mm256_storeu_pd(tile + 24, c30); _mm256_storeu_pd(tile + 28, c31);
+                    _mm256_storeu_pd(tile + 32, c40); _mm256_storeu_pd(tile + 36, c41);
+                    _mm256_storeu_pd(tile + 40, c50); _mm256_storeu_pd(tile + 44, c51);
+                }
+            };
+
+            template<>
+            struct GemvKernel<float>
+            {
+                static float dot(const float * a, const float * x, SizeT n) noexcept
+                {
+                    __m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps();
+                    SizeT j(0);
+
+                    for(; j + 16 <= n; j += 16)
+                    {
+                        s0 = _mm256_fmadd_ps(_mm256_loadu_ps(a + j), _mm256_loadu_ps(x + j), s0);
+                        s1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + j + 8), _mm256_loadu_ps(x + j + 8), s1);
+                    }
+
+                    float s(hsum(_mm256_add_ps(s0, s1)));
+
+                    for(; j < n; ++j)
+                        s += a[j] * x[j];
+
+                    return s;
+                }
+
+                static void dot4(const float * a, SizeT rowStride, const float * x, SizeT n, float * out) noexcept
+                {
+                    const float * a0(a), * a1(a + rowStride), * a2(a + 2 * rowStride), * a3(a + 3 * rowStride);
+
+                    __m256 s0 = _mm256_setzero_ps(), s1 = _mm256_setzero_ps();
+                    __m256 s2 = _mm256_setzero_ps(), s3 = _mm256_setzero_ps();
+                    SizeT j(0);
+
+                    for(; j + 8 <= n; j += 8)
+                    {
+                        __m256 xv = _mm256_loadu_ps(x + j);
+
+                        s0 = _mm256_fmadd_ps(_mm256_loadu_ps(a0 + j), xv, s0);
+                        s1 = _mm256_fmadd_ps(_mm256_loadu_ps(a1 + j), xv, s1);
+                        s2 = _mm256_fmadd_ps(_mm256_loadu_ps(a2 + j), xv, s2);
+                        s3 = _mm256_fmadd_ps(_mm256_loadu_ps(a3 + j), xv, s3);
+                    }
+
+                    out[0] = hsum(s0); out[1] = hsum(s1); out[2] = hsum(s2); out[3] = hsum(s3);
+
+                    for(; j < n; ++j)
+                    {
+                        out[0] += a0[j] * x[j]; out[1] += a1[j] * x[j];
+                        out[2] += a2[j] * x[j]; out[3] += a3[j] * x[j];
+                    }
+                }
+            };
+
+            template<>
+            struct GemvKernel<double>
+            {
+                static double dot(const double * a, const double * x, SizeT n) noexcept
+                {
+                    __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+                    SizeT j(0);
+
+                    for(; j + 8 <= n; j += 8)
+                    {
+                        s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + j), _mm256_loadu_pd(x + j), s0);
+                        s1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + j + 4), _mm256_loadu_pd(x + j + 4), s1);
+                    }
+
+                    double s(hsum(_mm256_add_pd(s0, s1)));
+
+                    for(; j < n; ++j)
+                        s += a[j] * x[j];
+
+                    return s;
+                }
+
+                static void dot4(const double * a, SizeT rowStride, const double * x, SizeT n, double * out) noexcept
+                {
+                    const double * a0(a), * a1(a + rowStride), * a2(a + 2 * rowStride), * a3(a + 3 * rowStride);
+
+                    __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+                    __m256d s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+                    SizeT j(0);
+
+                    for(; j + 4 <= n; j += 4)
+                    {
+                        __m256d xv = _mm256_loadu_pd(x + j);
+
+                        s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a0 + j), xv, s0);
+                        s1 = _mm256_fmadd_pd(_mm256_loadu_pd(a1 + j), xv, s1);
+                        s2 = _mm256_fmadd_pd(_mm256_loadu_pd(a2 + j), xv, s2);
+                        s3 = _mm256_fmadd_pd(_mm256_loadu_pd(a3 + j), xv, s3);
+                    }
+
+                    out[0] = hsum(s0); out[1] = hsum(s1); out[2] = hsum(s2); out[3] = hsum(s3);
+
+                    for(; j < n; ++j)
+                    {
+                        out[0] += a0[j] * x[j]; out[1] += a1[j] * x[j];
+                        out[2] += a2[j] * x[j]; out[3] += a3[j] * x[j];
+                    }
+                }
+            };
+
+        #endif
+
+            // Slivers of mr rows of a, k major : [sliver][p][i], zero padded
+            template<typename T, SizeT MR>
+            void packA(const Matrix<const T> & a, SizeT i0, SizeT rows, SizeT p0, SizeT k, T * dst) noexcept
+            {
+                for(SizeT s(0); s < rows; s += MR, dst += MR * k)
+                {
+                    SizeT valid(ma::min(MR, rows - s));
+
+                    for(SizeT p(0); p < k; ++p)
+                        for(SizeT i(0); i < MR; ++i)
+                            dst[p * MR + i] = (i < valid) ? a(i0 + s + i, p0 + p) : T(0);
+                }
+            }
+
+            // Slivers of nr columns of b : [sliver][p][j], zero padded
+            template<typename T, SizeT NR>
+            void packB(const Matrix<const T> & b, SizeT p0, SizeT k, SizeT j0, SizeT cols, T * dst) noexcept
+            {
+                SizeT valid(ma::min(NR, cols));
+
+                for(SizeT p(0); p < k; ++p)
+                    for(SizeT j(0); j < NR; ++j)
+                        dst[p * NR + j] = (j < valid) ? b(p0 + p, j0 + j) : T(0);
+            }
+
+            // fn(first, last) on [begin, end), split between the threads of pool if there is one
+            template<typename Fn>
+            void forRange(parallel::ThreadPool * pool, SizeT begin, SizeT end, SizeT grain, Fn && fn)
+            {
+                if(pool)
+                    pool->parallelFor(begin, end, grain, forward<Fn>(fn));
+                else if(begin < end)
+                    fn(begin, end);
+            }
+
+            template<typename T>
+            void scale(const Matrix<T> & c, T beta)
+            {
+                for(SizeT i(0); i < c.rows; ++i)
+                    for(SizeT j(0); j < c.cols; ++j)
+                        update(c(i, j), T(0), T(0), beta);
+            }
+
+            /**
+             * c = alpha * a * b + beta * c, blocked as in Goto & van de Geijn :
+             * panels of b are packed once and shared, each task packs a block
+             * of rows of a and runs the micro kernel over it.
+             **/
+            template<typename T>
+            void gemm(parallel::ThreadPool * pool, T alpha, const Matrix<const T> & a, const Matrix<const T> & b, T beta, const Matrix<T> & c)
+            {
+                using K = GemmKernel<T>;
+
+                constexpr SizeT MR(K::mr), NR(K::nr), KC(K::kc), MC(K::mc), NC(K::nc);
+
+                throwIfMismatch(a.cols, b.rows, "ERROR : inner dimensions of the product differ");
+                throwIfMismatch(a.rows, c.rows, "ERROR : rows of the product differ");
+                throwIfMismatch(b.cols, c.cols, "ERROR : columns of the product differ");
+
+                SizeT m(c.rows), n(c.cols), k(a.cols);
+
+                if(m == 0 || n == 0) return;
+
+                if(k == 0 || alpha == T(0))
+                {
+                    scale(c, beta);
+                    return;
+                }
+
+                std::vector<T> packedB(ceil(ma::min(NC, n), NR) * NR * ma::min(KC, k));
+
+                for(SizeT j0(0); j0 < n; j0 += NC)
+                {
+                    SizeT nb(ma::min(NC, n - j0)), slivers(ceil(nb, NR));
+
+                    for(SizeT p0(0); p0 < k; p0 += KC)
+                    {
+                        SizeT kb(ma::min(KC, k - p0));
+                        T betaBlock(p0 == 0 ? beta : T(1));
+                        T * bp(packedB.data());
+
+                        forRange(pool, 0, slivers, 16, [&](SizeT first, SizeT last)
+                        {
+                            for(SizeT s(first); s < last; ++s)
+                                packB<T, NR>(b, p0, kb, j0 + s * NR, nb - s * NR, bp + s * NR * kb);
+                        });
+
+                        forRange(pool, 0, ceil(m, MC), 1, [&](SizeT first, SizeT last)
+                        {
+                            T * ap(scratch<T, 0>(MC * KC));
+                            T tile[MR * NR];
+
+                            for(SizeT block(first); block < last; ++block)
+                            {
+                                SizeT i0(block * MC), mb(ma::min(MC, m - i0));
+
+                                packA<T, MR>(a, i0, mb, p0, kb, ap);
+
+                                for(SizeT js(0); js < slivers; ++js)
+                                    for(SizeT is(0); is * MR < mb; ++is)
+                                    {
+                                        K::micro(kb, ap + is * MR * kb, bp + js * NR * kb, tile);
+
+                                        SizeT rows(ma::min(MR, mb - is * MR)), cols(ma::min(NR, nb - js * NR));
+                                        SizeT ci(i0 + is * MR), cj(j0 + js * NR);
+
+                                        for(SizeT i(0); i < rows; ++i)
+                                            for(SizeT j(0); j < cols; ++j)
+                                                update(c(ci + i, cj + j), tile[i * NR + j], alpha, betaBlock);
+                                    }
+                            }
+                        });
+                    }
+                }
+            }
+
+            /**
+             * y = alpha * a * x + beta * y, rows of y split between the threads.
+             * Rows of a contiguous : dot products, 4 rows per pass over x.
+             * Columns contiguous : sum of the columns scaled by x.
+             * Other strides : each row is copied before its dot product.
+             **/
+            template<typename T>
+            void gemv(parallel::ThreadPool * pool, T alpha, const Matrix<const T> & a, const Vector<const T> & x, T beta, const Vector<T> & y)
+            {
+                throwIfMismatch(a.cols, x.size, "ERROR : columns of the matrix and vector size differ");
+                throwIfMismatch(a.rows, y.size, "ERROR : rows of the matrix and result size differ");
+
+                SizeT m(a.rows), n(a.cols);
+
+                if(m == 0) return;
+
+                std::vector<T> packedX;
+                const T * xs(x.data);
+
+                if(x.stride != 1)
+                {
+                    packedX.resize(n);
+                    for(SizeT j(0); j < n; ++j) packedX[j] = x[j];
+                    xs = packedX.data();
+                }
+
+                SizeT grain(ma::max(SizeT(16), ceil(ceil(m, (pool ? pool->size() : 1) * 4), 4) * 4));
+
+                if(a.colStride == 1)
+                    forRange(pool, 0, m, grain, [&](SizeT first, SizeT last)
+                    {
+                        T out[4];
+                        SizeT i(first);
+
+                        for(; i + 4 <= last; i += 4)
+                        {
+                            GemvKernel<T>::dot4(&a(i, 0), a.rowStride, xs, n, out);
+
+                            for(SizeT r(0); r < 4; ++r)
+                                update(y[i + r], out[r], alpha, beta);
+                        }
+
+                        for(; i < last; ++i)
+                            update(y[i], GemvKernel<T>::dot(&a(i, 0), xs, n), alpha, beta);
+                    });
+                else if(a.rowStride == 1)
+                    forRange(pool, 0, m, grain, [&](SizeT first, SizeT last)
+                    {
+                        SizeT rows(last - first);
+                        T * acc(scratch<T, 1>(rows));
+
+                        for(SizeT i(0); i < rows; ++i) acc[i] = T(0);
+
+                        for(SizeT j(0); j < n; ++j)
+                        {
+                            const T * col(&a(first, j));
+                            T xj(xs[j]);
+
+                            for(SizeT i(0); i < rows; ++i)
+                                acc[i] += col[i] * xj;
+                        }
+
+                        for(SizeT i(0); i < rows; ++i)
+                            update(y[first + i], acc[i], alpha, beta);
+                    });
+                else
+                    forRange(pool, 0, m, grain, [&](SizeT first, SizeT last)
+                    {
+                        T * row(scratch<T, 1>(n));
+
+                        for(SizeT i(first); i < last; ++i)
+                        {
+                            for(SizeT j(0); j < n; ++j) row[j] = a(i, j);
+
+                            update(y[i], GemvKernel<T>::dot(row, xs, n), alpha, beta);
+                        }
+                    });
+            }
+
+            template<typename T>
+            Matrix<const T> constMatrix(const Matrix<T> & m) noexcept
+            {
+                return {m.data, m.rows, m.cols, m.rowStride, m.colStride};
+            }
+
+            template<typename T>
+            Vector<const T> constVector(const Vector<T> & v) noexcept
+            {
+                return {v.data, v.size, v.stride};
+            }
+        }
+
+        template<typename View>
+        using ValueOf = remove_const_t<typename decay_t<View>::value_type>;
+
+        /**
+         * c = alpha * a * b + beta * c on 2 dimensions views of any strides.
+         * With beta == 0, c is only written. The blocks of rows of c are
+         * split between the threads of pool, without pool the product runs
+         * on the calling thread.
+         **/
+        template<typename A, typename B, typename C>
+        void gemm(parallel::ThreadPool & pool, ValueOf<C> alpha, const A & a, const B & b, ValueOf<C> beta, C && c)
+        {
+            using T = ValueOf<C>;
+
+            impl::gemm<T>(&pool, alpha, impl::constMatrix(impl::matrix(a)), impl::constMatrix(impl::matrix(b)), beta, impl::matrix(c));
+        }
+
+        template<typename A, typename B, typename C>
+        void gemm(ValueOf<C> alpha, const A & a, const B & b, ValueOf<C> beta, C && c)
+        {
+            using T = ValueOf<C>;
+
+            impl::gemm<T>(nullptr, alpha, impl::constMatrix(impl::matrix(a)), impl::constMatrix(impl::matrix(b)), beta, impl::matrix(c));
+        }
+
+        /**
+         * y = alpha * a * x + beta * y, a of 2 dimensions, x and y of 1 dimension
+         **/
+        template<typename A, typename X, typename Y>
+        void gemv(parallel::ThreadPool & pool, ValueOf<Y> alpha, const A & a, const X & x, ValueOf<Y> beta, Y && y)
+        {
+            using T = ValueOf<Y>;
+
+            impl::gemv<T>(&pool, alpha, impl::constMatrix(impl::matrix(a)), impl::constVector(impl::vector(x)), beta, impl::vector(y));
+        }
+
+        template<typename A, typename X, typename Y>
+        void gemv(ValueOf<Y> alpha, const A & a, const X & x, ValueOf<Y> beta, Y && y)
+        {
+            using T = ValueOf<Y>;
+
+            impl::gemv<T>(nullptr, alpha, impl::constMatrix(impl::matrix(a)), impl::constVector(impl::vector(x)), beta, impl::vector(y));
+        }
+    }
+}
+
+#endif //MA_LINALG_GEMM_H
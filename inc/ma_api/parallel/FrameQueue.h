@@ -0,0 +1,218 @@
+#ifndef MA_PARALLEL_FRAME_QUEUE_H
+#define MA_PARALLEL_FRAME_QUEUE_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+namespace ma
+{
+    namespace parallel
+    {
+        /**
+         * Bounded lock-free queue of indices, safe for any number of producers
+         * and consumers. Each cell carries a sequence number telling whether it
+         * is ready to be written or read for the current lap.
+         **/
+        class IndexRing
+        {
+            struct Cell
+            {
+                std::atomic<SizeT> sequence;
+                SizeT value;
+            };
+
+            std::unique_ptr<Cell[]> cells_;
+            SizeT mask_;
+
+            // Keep producers and consumers counters on their own cache lines
+            char padBefore_[64];
+            std::atomic<SizeT> enqueue_;
+            char padBetween_[64];
+            std::atomic<SizeT> dequeue_;
+            char padAfter_[64];
+
+        public:
+            explicit IndexRing(SizeT capacity) :
+                cells_(), mask_(roundPow2(capacity) - 1), enqueue_(0), dequeue_(0)
+            {
+                cells_.reset(new Cell[mask_ + 1]);
+
+                for(SizeT i(0); i <= mask_; ++i)
+                    cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+
+            IndexRing(const IndexRing &) = delete;
+            IndexRing & operator=(const IndexRing &) = delete;
+
+            static SizeT roundPow2(SizeT n) noexcept
+            {
+                SizeT p(1);
+                while(p < n) p <<= 1;
+                return p;
+            }
+
+            bool push(SizeT value) noexcept
+            {
+                SizeT pos(enqueue_.load(std::memory_order_relaxed));
+                Cell * cell;
+
+                for(;;)
+                {
+                    cell = &cells_[pos & mask_];
+                    DiffT dif(cell->sequence.load(std::memory_order_acquire) - pos);
+
+                    if(dif == 0)
+                    {
+                        if(enqueue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if(dif < 0)
+                        return false;
+                    else
+                        pos = enqueue_.load(std::memory_order_relaxed);
+                }
+
+                cell->value = value;
+                cell->sequence.store(pos + 1, std::memory_order_release);
+
+                return true;
+            }
+
+            bool pop(SizeT & value) noexcept
+            {
+                SizeT pos(dequeue_.load(std::memory_order_relaxed));
+                Cell * cell;
+
+                for(;;)
+                {
+                    cell = &cells_[pos & mask_];
+                    DiffT dif(cell->sequence.load(std::memory_order_acquire) - (pos + 1));
+
+                    if(dif == 0)
+                    {
+                        if(dequeue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            break;
+                    }
+                    else if(dif < 0)
+                        return false;
+                    else
+                        pos = dequeue_.load(std::memory_order_relaxed);
+                }
+
+                value = cell->value;
+                cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+
+                return true;
+            }
+        };
+
+        /**
+         * Handoff of preallocated frames between pipeline stages. Producers take a
+         * free frame, fill it and publish it, consumers pop it and release it back.
+         * Frames are passed by slot index, so a handoff neither allocates nor
+         * touches the reference count of shared arrays.
+         **/
+        template<typename ArrayT>
+        class FrameQueue
+        {
+            std::vector<ArrayT> frames_;
+            IndexRing free_;
+            IndexRing ready_;
+
+        public:
+            /**
+             * capacity frames, each built with frameArgs
+             **/
+            template<typename... Args>
+            explicit FrameQueue(SizeT capacity, const Args & ... frameArgs) :
+                frames_(), free_(capacity), ready_(capacity)
+            {
+                frames_.reserve(capacity);
+
+                for(SizeT slot(0); slot < capacity; ++slot)
+                {
+                    frames_.emplace_back(frameArgs...);
+                    free_.push(slot);
+                }
+            }
+
+            SizeT capacity() const noexcept
+            {
+                return ma::size(frames_);
+            }
+
+            ArrayT & frame(SizeT slot) noexcept
+            {
+                return frames_[slot];
+            }
+
+            const ArrayT & frame(SizeT slot) const noexcept
+            {
+                return frames_[slot];
+            }
+
+            /**
+             * Take a free frame to fill, false if all frames are in flight
+             **/
+            bool tryAcquire(SizeT & slot) noexcept
+            {
+                return free_.pop(slot);
+            }
+
+            void publish(SizeT slot) noexcept
+            {
+                // Can't fail : the ring holds as many cells as frames
+                ready_.push(slot);
+            }
+
+            /**
+             * Take the oldest published frame, false if none
+             **/
+            bool tryPop(SizeT & slot) noexcept
+            {
+                return ready_.pop(slot);
+            }
+
+            void release(SizeT slot) noexcept
+            {
+                free_.push(slot);
+            }
+
+            /**
+             * Fill a free frame with fill(frame) and publish it
+             **/
+            template<typename Fn>
+            bool tryPush(Fn && fill)
+            {
+                SizeT slot;
+                if(!tryAcquire(slot)) return false;
+
+                fill(frames_[slot]);
+                publish(slot);
+
+                return true;
+            }
+
+            /**
+             * Process the oldest frame with fn(frame) and release it
+             **/
+            template<typename Fn>
+            bool tryConsume(Fn && fn)
+            {
+                SizeT slot;
+                if(!tryPop(slot)) return false;
+
+                fn(static_cast<const ArrayT &>(frames_[slot]));
+                release(slot);
+
+                return true;
+            }
+        };
+    }
+}
+
+#endif //MA_PARALLEL_FRAME_QUEUE_H
@@ -0,0 +1,251 @@
+#ifndef MA_PARALLEL_THREAD_POOL_H
+#define MA_PARALLEL_THREAD_POOL_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+namespace ma
+{
+    namespace parallel
+    {
+        /**
+         * Pool running loops over index ranges. Each participant owns a part of
+         * the range and consumes it by grains, an idle participant steals half
+         * of the remaining part of another one. The calling thread participates,
+         * so a pool of n threads runs n + 1 participants.
+         **/
+        class ThreadPool
+        {
+            struct Slot
+            {
+                std::mutex mutex;
+                SizeT begin = 0;
+                SizeT end = 0;
+            };
+
+            std::vector<std::thread> workers_;
+            std::unique_ptr<Slot[]> slots_;
+
+            std::mutex mutex_;
+            std::condition_variable wake_;
+            std::condition_variable done_;
+
+            // Only one loop at a time, loops are not queued
+            std::mutex run_;
+
+            std::function<void(SizeT, SizeT)> task_;
+            std::exception_ptr error_;
+            SizeT grain_;
+            std::size_t generation_;
+            SizeT active_;
+            bool stop_;
+
+        public:
+            explicit ThreadPool(SizeT threadNb = defaultThreadNb()) :
+                workers_(), slots_(new Slot[threadNb + 1]), grain_(1), generation_(0), active_(0), stop_(false)
+            {
+                workers_.reserve(threadNb);
+
+                for(SizeT id(0); id < threadNb; ++id)
+                    workers_.emplace_back([this, id]{ workerLoop(id); });
+            }
+
+            ThreadPool(const ThreadPool &) = delete;
+            ThreadPool & operator=(const ThreadPool &) = delete;
+
+            ~ThreadPool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+                wake_.notify_all();
+
+                for(auto & worker : workers_)
+                    worker.join();
+            }
+
+            static SizeT defaultThreadNb() noexcept
+            {
+                return ma::max(SizeT(std::thread::hardware_concurrency()), SizeT(1)) - 1;
+            }
+
+            /**
+             * Pool shared by the library functions
+             **/
+            static ThreadPool & global()
+            {
+                static ThreadPool pool;
+                return pool;
+            }
+
+            /**
+             * Number of threads running a loop, including the caller
+             **/
+            SizeT size() const noexcept
+            {
+                return workers_.size() + 1;
+            }
+
+            /**
+             * Call fn(first, last) on sub ranges of [begin, end) of at most grain
+             * indices, and return once all are done. The first exception thrown
+             * by fn is rethrown. Nested calls run on the calling thread.
+             **/
+            template<typename Fn>
+            void parallelFor(SizeT begin, SizeT end, SizeT grain, Fn && fn)
+            {
+                grain = ma::max(grain, SizeT(1));
+
+                if(end <= begin) return;
+
+                if(workers_.empty() || inPool() || end - begin <= grain)
+                {
+                    for(SizeT first(begin); first < end; first += grain)
+                        fn(first, ma::min(end, first + grain));
+                    return;
+                }
+
+                std::lock_guard<std::mutex> run(run_);
+
+                SizeT chunk(ceil(end - begin, size()));
+                for(SizeT id(0); id < size(); ++id)
+                {
+                    std::lock_guard<std::mutex> lock(slots_[id].mutex);
+                    slots_[id].begin = ma::min(end, begin + id * chunk);
+                    slots_[id].end = ma::min(end, begin + (id + 1) * chunk);
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    task_ = [&fn](SizeT first, SizeT last){ fn(first, last); };
+                    error_ = nullptr;
+                    grain_ = grain;
+                    active_ = workers_.size();
+                    ++generation_;
+                }
+                wake_.notify_all();
+
+                participate(workers_.size());
+
+                std::unique_lock<std::mutex> lock(mutex_);
+                done_.wait(lock, [this]{ return active_ == 0; });
+
+                task_ = nullptr;
+
+                if(error_)
+                    std::rethrow_exception(error_);
+            }
+
+        protected:
+            static bool & inPool() noexcept
+            {
+                static thread_local bool in(false);
+                return in;
+            }
+
+            void workerLoop(SizeT id)
+            {
+                std::size_t seen(0);
+
+                for(;;)
+                {
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        wake_.wait(lock, [&]{ return stop_ || generation_ != seen; });
+
+                        if(stop_) return;
+
+                        seen = generation_;
+                    }
+
+                    participate(id);
+
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if(--active_ == 0)
+                        done_.notify_one();
+                }
+            }
+
+            void participate(SizeT id)
+            {
+                inPool() = true;
+
+                SizeT first, last;
+                while(take(id, first, last) || steal(id, first, last))
+                {
+                    try
+                    {
+                        task_(first, last);
+                    }
+                    catch(...)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        if(!error_)
+                            error_ = std::current_exception();
+                    }
+                }
+
+                inPool() = false;
+            }
+
+            bool take(SizeT id, SizeT & first, SizeT & last)
+            {
+                Slot & slot(slots_[id]);
+                std::lock_guard<std::mutex> lock(slot.mutex);
+
+                if(slot.begin >= slot.end)
+                    return false;
+
+                first = slot.begin;
+                last = ma::min(slot.end, first + grain_);
+                slot.begin = last;
+
+                return true;
+            }
+
+            // Only the owner refills its slot, so an empty slot stays empty for thieves
+            bool steal(SizeT id, SizeT & first, SizeT & last)
+            {
+                for(SizeT offset(1); offset < size(); ++offset)
+                {
+                    Slot & victim(slots_[(id + offset) % size()]);
+                    SizeT end;
+
+                    {
+                        std::lock_guard<std::mutex> lock(victim.mutex);
+
+                        SizeT remaining(victim.end - victim.begin);
+                        if(remaining <= 0)
+                            continue;
+
+                        end = victim.end;
+                        first = (remaining > grain_) ? victim.begin + remaining / 2 : victim.begin;
+                        victim.end = first;
+                    }
+
+                    last = ma::min(end, first + grain_);
+
+                    Slot & own(slots_[id]);
+                    std::lock_guard<std::mutex> lock(own.mutex);
+                    own.begin = last;
+                    own.end = end;
+
+                    return true;
+                }
+
+                return false;
+            }
+        };
+    }
+}
+
+#endif //MA_PARALLEL_THREAD_POOL_H
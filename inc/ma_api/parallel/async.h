@@ -0,0 +1,359 @@
+#ifndef MA_PARALLEL_ASYNC_H
+#define MA_PARALLEL_ASYNC_H
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ma_api/config.h>
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+#include <ma_api/array/ArrayView.h>
+
+#if MA_COROUTINE
+#include <coroutine>
+#endif
+
+namespace ma
+{
+    namespace parallel
+    {
+        namespace impl
+        {
+            struct CompletionState
+            {
+                std::mutex mutex;
+                std::condition_variable cv;
+                std::vector<std::function<void()>> continuations;
+                std::exception_ptr error;
+                bool done = false;
+
+                void finish(std::exception_ptr e)
+                {
+                    std::vector<std::function<void()>> waiting;
+
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        done = true;
+                        error = e;
+                        swap(waiting, continuations);
+                    }
+                    cv.notify_all();
+
+                    for(auto & fn : waiting)
+                        fn();
+                }
+
+                // false if already done, fn is then not kept
+                bool deferIfPending(std::function<void()> & fn)
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+
+                    if(done) return false;
+
+                    continuations.push_back(move(fn));
+                    return true;
+                }
+
+                void onDone(std::function<void()> fn)
+                {
+                    if(!deferIfPending(fn))
+                        fn();
+                }
+            };
+        }
+
+        class AsyncQueue;
+
+        /**
+         * Completion token of a task run by an AsyncQueue
+         **/
+        class Completion
+        {
+            std::shared_ptr<impl::CompletionState> state_;
+            AsyncQueue * queue_;
+
+            friend class AsyncQueue;
+
+            Completion(std::shared_ptr<impl::CompletionState> state, AsyncQueue * queue) noexcept :
+                state_(move(state)), queue_(queue)
+            {}
+
+        public:
+            Completion() noexcept :
+                state_(), queue_(nullptr)
+            {}
+
+            bool valid() const noexcept
+            {
+                return bool(state_);
+            }
+
+            bool ready() const
+            {
+                massert(valid());
+
+                std::lock_guard<std::mutex> lock(state_->mutex);
+                return state_->done;
+            }
+
+            void wait() const
+            {
+                massert(valid());
+
+                std::unique_lock<std::mutex> lock(state_->mutex);
+                state_->cv.wait(lock, [this]{ return state_->done; });
+            }
+
+            /**
+             * Wait for the task and rethrow its exception if any
+             **/
+            void get() const
+            {
+                wait();
+
+                if(state_->error)
+                    std::rethrow_exception(state_->error);
+            }
+
+            /**
+             * Run fn on the same queue once this task succeeded. If it failed,
+             * fn is not called and the returned completion holds the same error.
+             **/
+            template<typename Fn>
+            Completion then(Fn fn) const;
+
+        #if MA_COROUTINE
+            struct Awaiter
+            {
+                std::shared_ptr<impl::CompletionState> state;
+
+                bool await_ready() const
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    return state->done;
+                }
+
+                bool await_suspend(std::coroutine_handle<> handle)
+                {
+                    std::function<void()> resume([handle]{ handle.resume(); });
+                    return state->deferIfPending(resume);
+                }
+
+                void await_resume() const
+                {
+                    if(state->error)
+                        std::rethrow_exception(state->error);
+                }
+            };
+
+            /**
+             * The coroutine resumes on the queue thread that completed the task
+             **/
+            Awaiter operator co_await() const noexcept
+            {
+                return Awaiter{state_};
+            }
+        #endif
+        };
+
+        /**
+         * Background threads running tasks in submission order, for work that
+         * overlaps with the caller (copies of the next frame, ...). With one
+         * thread the tasks also complete in order. A task must not wait on a
+         * task submitted after it to the same queue.
+         **/
+        class AsyncQueue
+        {
+            std::vector<std::thread> workers_;
+            std::deque<std::function<void()>> jobs_;
+
+            std::mutex mutex_;
+            std::condition_variable wake_;
+            bool stop_;
+
+        public:
+            explicit AsyncQueue(SizeT threadNb = 1) :
+                workers_(), jobs_(), stop_(false)
+            {
+                threadNb = ma::max(threadNb, SizeT(1));
+                workers_.reserve(threadNb);
+
+                for(SizeT id(0); id < threadNb; ++id)
+                    workers_.emplace_back([this]{ workerLoop(); });
+            }
+
+            AsyncQueue(const AsyncQueue &) = delete;
+            AsyncQueue & operator=(const AsyncQueue &) = delete;
+
+            /**
+             * Pending tasks are run before the threads exit
+             **/
+            ~AsyncQueue()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    stop_ = true;
+                }
+                wake_.notify_all();
+
+                for(auto & worker : workers_)
+                    worker.join();
+            }
+
+            /**
+             * Queue used by copyToAsync and setMemAsync by default
+             **/
+            static AsyncQueue & global()
+            {
+                static AsyncQueue queue;
+                return queue;
+            }
+
+            SizeT size() const noexcept
+            {
+                return workers_.size();
+            }
+
+            template<typename Fn>
+            Completion submit(Fn fn)
+            {
+                auto state = std::make_shared<impl::CompletionState>();
+
+                post([state, fn]() mutable { run(*state, fn); });
+
+                return Completion(move(state), this);
+            }
+
+        protected:
+            template<typename Fn>
+            static void run(impl::CompletionState & state, Fn & fn)
+            {
+                std::exception_ptr error;
+
+                try
+                {
+                    fn();
+                }
+                catch(...)
+                {
+                    error = std::current_exception();
+                }
+
+                state.finish(error);
+            }
+
+            void post(std::function<void()> job)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    jobs_.push_back(move(job));
+                }
+                wake_.notify_one();
+            }
+
+            void workerLoop()
+            {
+                for(;;)
+                {
+                    std::function<void()> job;
+
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        wake_.wait(lock, [this]{ return stop_ || !jobs_.empty(); });
+
+                        if(jobs_.empty()) return;
+
+                        job = move(jobs_.front());
+                        jobs_.pop_front();
+                    }
+
+                    job();
+                }
+            }
+
+            friend class Completion;
+        };
+
+        template<typename Fn>
+        Completion Completion::then(Fn fn) const
+        {
+            massert(valid());
+
+            auto next = std::make_shared<impl::CompletionState>();
+            auto prev = state_;
+            AsyncQueue * queue(queue_);
+
+            state_->onDone([prev, next, queue, fn]
+            {
+                if(prev->error)
+                    next->finish(prev->error);
+                else
+                    queue->post([next, fn]() mutable { AsyncQueue::run(*next, fn); });
+            });
+
+            return Completion(move(next), queue);
+        }
+
+        namespace impl
+        {
+            template<typename T, typename Allocator, typename Shape>
+            std::true_type isView(const array::ArrayView<T, Allocator, Shape> *);
+
+            std::false_type isView(...);
+
+            // Arrays are captured as views of their memory, without copying the container
+            template<typename T, typename Allocator, typename Shape>
+            array::ArrayView<T, Allocator, Shape> captureOf(const array::ArrayView<T, Allocator, Shape> & view, std::true_type)
+            {
+                return view;
+            }
+
+            template<typename Data>
+            decay_t<Data> captureOf(Data && data, std::false_type)
+            {
+                return forward<Data>(data);
+            }
+
+            template<typename Data>
+            auto captureOf(Data && data) -> decltype(captureOf(forward<Data>(data), decltype(isView(&data))()))
+            {
+                return captureOf(forward<Data>(data), decltype(isView(&data))());
+            }
+        }
+
+        /**
+         * view.copyTo(data) run on queue, the call returns at once. Arrays
+         * are captured as views and pointers as they are : the memory of
+         * view and data must stay valid until the completion is ready.
+         **/
+        template<typename View, typename OData>
+        Completion copyToAsync(const View & view, OData && data, AsyncQueue & queue = AsyncQueue::global())
+        {
+            return queue.submit([src = impl::captureOf(view), dst = impl::captureOf(forward<OData>(data))]() mutable
+            {
+                src.copyTo(dst);
+            });
+        }
+
+        /**
+         * view.setMem(data) run on queue, a value of the element type fills view
+         **/
+        template<typename View, typename OData>
+        Completion setMemAsync(const View & view, OData && data, AsyncQueue & queue = AsyncQueue::global())
+        {
+            return queue.submit([dst = impl::captureOf(view), src = impl::captureOf(forward<OData>(data))]() mutable
+            {
+                dst.setMem(src);
+            });
+        }
+    }
+}
+
+#endif //MA_PARALLEL_ASYNC_H
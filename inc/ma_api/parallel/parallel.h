@@ -0,0 +1,103 @@
+#ifndef MA_PARALLEL_PARALLEL_H
+#define MA_PARALLEL_PARALLEL_H
+
+#include <ma_api/type.h>
+#include <ma_api/function.h>
+
+#include <ma_api/parallel/ThreadPool.h>
+
+namespace ma
+{
+    namespace parallel
+    {
+        namespace impl
+        {
+            /**
+             * Enough tasks to balance the load, not so many that scheduling dominates
+             **/
+            inline SizeT defaultGrain(SizeT size, const ThreadPool & pool) noexcept
+            {
+                return ma::max(ceil(size, pool.size() * 8), SizeT(4096));
+            }
+
+            // Split [first, last) on the contiguous blocks of step elements
+            template<typename Fn>
+            void forBlocks(SizeT step, SizeT first, SizeT last, Fn && fn)
+            {
+                while(first < last)
+                {
+                    SizeT blockEnd(ma::min(last, (first / step + 1) * step));
+
+                    fn(first, blockEnd - first);
+
+                    first = blockEnd;
+                }
+            }
+        }
+
+        /**
+         * Call fn on each element of view, the elements are split in contiguous
+         * blocks run on the threads of pool. fn must support concurrent calls.
+         * grain is the number of elements of a task, 0 lets the pool choose.
+         **/
+        template<typename View, typename Fn>
+        void forEach(ThreadPool & pool, View && view, Fn fn, SizeT grain = 0)
+        {
+            SizeT size(ma::size(view));
+
+            if(size == 0) return;
+
+            SizeT step(contiguous(view) ? size : ma::step(view));
+
+            pool.parallelFor(0, size, grain ? grain : impl::defaultGrain(size, pool), [&](SizeT first, SizeT last)
+            {
+                impl::forBlocks(step, first, last, [&](SizeT pos, SizeT n)
+                {
+                    auto ptr = &view.val(pos);
+
+                    for(SizeT i(0); i < n; ++i)
+                        fn(ptr[i]);
+                });
+            });
+        }
+
+        template<typename View, typename Fn>
+        void forEach(View && view, Fn fn, SizeT grain = 0)
+        {
+            forEach(ThreadPool::global(), forward<View>(view), fn, grain);
+        }
+
+        /**
+         * dst element = fn(src element), src and dst must have the same size
+         **/
+        template<typename Src, typename Dst, typename Fn>
+        void transform(ThreadPool & pool, const Src & src, Dst && dst, Fn fn, SizeT grain = 0)
+        {
+            SizeT size(sizes(src, dst));
+
+            if(size == 0) return;
+
+            SizeT step((contiguous(src) && contiguous(dst)) ? size : steps(src, dst));
+
+            pool.parallelFor(0, size, grain ? grain : impl::defaultGrain(size, pool), [&](SizeT first, SizeT last)
+            {
+                impl::forBlocks(step, first, last, [&](SizeT pos, SizeT n)
+                {
+                    auto in = &src.val(pos);
+                    auto out = &dst.val(pos);
+
+                    for(SizeT i(0); i < n; ++i)
+                        out[i] = fn(in[i]);
+                });
+            });
+        }
+
+        template<typename Src, typename Dst, typename Fn>
+        void transform(const Src & src, Dst && dst, Fn fn, SizeT grain = 0)
+        {
+            transform(ThreadPool::global(), src, forward<Dst>(dst), fn, grain);
+        }
+    }
+}
+
+#endif //MA_PARALLEL_PARALLEL_H
@@ -211,6 +211,74 @@ namespace ma
     template<typename T, typename TT = void>
     using HasNotShapeMet = enable_if_t<not has_shape_met<T>::value, TT>;
 
+    /**
+     * Strided layout trait : views with a pointer and a shape giving strides
+     **/
+
+    namespace impl
+    {
+        template <typename T>
+        auto has_strided_layout_impl(int) -> decltype (
+            std::declval<const T&>().layout().strides(),
+            std::declval<const T&>().shape(),
+            std::declval<const T&>().ptr(),
+            std::true_type{});
+
+        template <typename T>
+        std::false_type has_strided_layout_impl(...);
+    }
+
+    template <typename T>
+    using has_strided_layout = decltype(impl::has_strided_layout_impl<T>(0));
+
+
+    /**
+     * Static shape trait
+     **/
+
+    namespace impl
+    {
+        template <typename T>
+        auto is_static_shape_impl(int) -> std::integral_constant<bool, T::isStatic>;
+
+        template <typename T>
+        std::false_type is_static_shape_impl(...);
+    }
+
+    template <typename T>
+    using is_static_shape = decltype(impl::is_static_shape_impl<T>(0));
+
+    template<typename T, typename TT = void>
+    using IsStaticShape = enable_if_t<is_static_shape<T>::value, TT>;
+
+    template<typename T, typename TT = void>
+    using IsNotStaticShape = enable_if_t<not is_static_shape<T>::value, TT>;
+
+
+    /**
+     * Shared container trait : copies share the same data
+     **/
+
+    namespace impl
+    {
+        template <typename T>
+        auto is_shared_container_impl(int) -> decltype (
+            std::declval<typename T::shared_container>(),
+            std::true_type{});
+
+        template <typename T>
+        std::false_type is_shared_container_impl(...);
+    }
+
+    template <typename T>
+    using is_shared_container = decltype(impl::is_shared_container_impl<T>(0));
+
+    template<typename T, typename TT = void>
+    using IsSharedContainer = enable_if_t<is_shared_container<T>::value, TT>;
+
+    template<typename T, typename TT = void>
+    using IsNotSharedContainer = enable_if_t<not is_shared_container<T>::value, TT>;
+
 
     // implementation from https://en.cppreference.com/w/cpp/types/result_of
     namespace impl {
@@ -19,6 +19,9 @@ namespace ma
     enum All{all, aut};
     enum Delay{delay, pass};
 
+    // Construct arrays with zero elements
+    enum Zeros{zeros};
+
     template<typename T>
     using DefaultAlloc = std::allocator<T>;
 
@@ -5,6 +5,7 @@
 #include <iostream>
 #include <wyrm>
 #include <ma>
+#include <ma_api/algorithm/parallelCopy.h>
 #include <typeList.h>
 #include <TypeDescriptor.h>
 
@@ -23,12 +24,16 @@ std::ostream& operator<<(std::ostream& s, const std::vector<T>& v) {
 
 namespace maw
 {
-    ma::VectRange strides(const ma::VectRange & range, ma::SizeT sizeT)
+    /**
+     * Strides in bytes of the array as it lays in memory, not as a dense copy
+     **/
+    template<typename ArrayT>
+    ma::VectRange byteStrides(const ArrayT & a, ma::SizeT sizeT)
     {
-        ma::VectRange res(ma::size(range));
+        ma::VectRange res(a.strides());
 
-        std::transform(range.rbegin(), range.rend(), res.rbegin(),
-        [sizeT] (ma::SizeT dim) mutable {return ma::exchange(sizeT, sizeT * dim); } );
+        for(auto & stride : res)
+            stride *= sizeT;
 
         return res;
     }
@@ -41,7 +46,7 @@ namespace maw
         return py::class_<ArrayT>(m ,fullName.data(), py::buffer_protocol())
             .def_buffer([](ArrayT &data)-> py::buffer_info {
                 auto shape = ma::shape(data);
-                auto stride = strides(shape, sizeT);
+                auto stride = byteStrides(data, sizeT);
 
                 return py::buffer_info(ma::ptrOf(data),
                 sizeT,
@@ -61,7 +66,141 @@ namespace maw
     }
 
     
-    
+
+    /**
+     * Select one axis of a with a python index or slice, without copy.
+     * A shape of MultiArray can't hold an axis of length zero, an empty
+     * range marks an axis closed by an index : slices selecting nothing
+     * raise IndexError where NumPy would return an empty view.
+     **/
+    template<typename ArrayT>
+    ArrayT selectAxis(const ArrayT & a, ma::SizeT axis, ma::SizeT length, py::handle index)
+    {
+        if(py::isinstance<py::slice>(index))
+        {
+            size_t start, stop, step, slicelength;
+            if (!py::reinterpret_borrow<py::slice>(index).compute(length, &start, &stop, &step, &slicelength))
+                throw py::error_already_set();
+
+            if(slicelength == 0)
+                throw py::index_error("Empty slices are not supported, MultiArray has no axis of length zero");
+
+            ma::SizeT first(start);
+            ma::DiffT sliceStep(static_cast<ma::DiffT>(step));
+
+            return a.subArrayAt(axis, ma::L(first, first + ma::SizeT(slicelength) * sliceStep, sliceStep));
+        }
+
+        ma::SizeT pos(index.cast<ma::SizeT>());
+
+        if(pos < 0) pos += length;
+
+        if(pos < 0 || pos >= length)
+            throw py::index_error("Index out of range");
+
+        return a.subArrayAt(axis, pos);
+    }
+
+    /**
+     * Python indexing : returns an array sharing the data of a or a scalar
+     **/
+    template<typename ArrayT>
+    py::object getItem(const ArrayT & a, py::object key)
+    {
+        py::tuple indices = py::isinstance<py::tuple>(key)
+            ? py::reinterpret_borrow<py::tuple>(key)
+            : py::make_tuple(key);
+
+        auto shape = ma::shape(a);
+
+        if(indices.size() > shape.size())
+            throw py::index_error("Too many indices for array");
+
+        ArrayT res(a);
+
+        // Last axis first : closing an axis doesn't move the axes before it
+        for(ma::SizeT axis(indices.size()); axis-- > 0;)
+            res = selectAxis(res, axis, shape[axis], indices[axis]);
+
+        if(res.ndim() == 0)
+            return py::cast(res.val());
+
+        return py::cast(res);
+    }
+
+    /**
+     * View on the memory of a python buffer, described with its own strides
+     **/
+    template<typename T>
+    ma::StridedArrayView<T> bufferView(const py::buffer_info & info)
+    {
+        if(info.itemsize != sizeof(T) || !info.item_type_is_equivalent_to<T>())
+            throw py::type_error("Buffer format doesn't match array type " + appendName<T>(""));
+
+        ma::VectRange extents(info.shape.begin(), info.shape.end());
+        ma::VectRange strides(info.ndim);
+
+        for(ma::SizeT dim(0); dim < info.ndim; ++dim)
+        {
+            if(info.shape[dim] == 0)
+                throw py::value_error("Empty buffers are not supported, MultiArray has no axis of length zero");
+
+            if(info.strides[dim] % ma::SizeT(sizeof(T)) != 0)
+                throw py::value_error("Buffer strides must be a multiple of the item size");
+
+            strides[dim] = info.strides[dim] / ma::SizeT(sizeof(T));
+        }
+
+        return ma::StridedArrayView<T>(ma::StridedShape(extents, strides), static_cast<T*>(info.ptr));
+    }
+
+    template<typename ArrayT, typename View>
+    void throwIfShapeMismatch(const ArrayT & a, const View & view)
+    {
+        if(ma::shape(a) != view.shape())
+            throw py::value_error("Buffer shape doesn't match array shape");
+    }
+
+    /**
+     * Copy between the array and the buffer without holding the GIL
+     **/
+    template<typename T, typename DST, typename SRC>
+    void transfer(DST & dst, const SRC & src)
+    {
+        py::gil_scoped_release release;
+
+        ma::algorithm::multiCopyParallel<T>(ma::parallel::ThreadPool::global(), dst, src);
+    }
+
+    template<typename T, typename ArrayT>
+    void bindTransfer(py::class_<ArrayT> & pyclass)
+    {
+        pyclass.def_static("from_buffer", [](py::buffer b)
+        {
+            auto src = bufferView<T>(b.request());
+            ArrayT a(src.shape());
+
+            transfer<T>(a, src);
+
+            return a;
+        }, "Create an array holding a copy of the buffer content");
+
+        pyclass.def("copy_from", [](ArrayT & a, py::buffer b)
+        {
+            auto src = bufferView<T>(b.request());
+            throwIfShapeMismatch(a, src);
+
+            transfer<T>(a, src);
+        }, "Copy the buffer content into the array");
+
+        pyclass.def("copy_to", [](const ArrayT & a, py::buffer b)
+        {
+            auto dst = bufferView<T>(b.request(true));
+            throwIfShapeMismatch(a, dst);
+
+            transfer<T>(dst, a);
+        }, "Copy the array content into a writable buffer");
+    }
 
     // template<>
     // void bindItemAccess(Class & pyclass)
@@ -95,19 +234,13 @@ namespace maw
         pyclass.def_property_readonly("ndim", [](const ArrayT& a) { return ma::size(ma::shape<ArrayT>(a)); });
         pyclass.def_property_readonly("itemsize", [](const ArrayT&) { return sizeof(T); });
         pyclass.def_property_readonly("nbytes", [](const ArrayT& a) { return sizeof(T) * ma::size(a); });
-        pyclass.def("__getitem__", [](const ArrayT& a, std::vector<py::slice> slice)
+        pyclass.def("__getitem__", [](const ArrayT& a, py::object key)
         {
-            std::cout << "slice\n";
-            size_t start, stop, step, slicelength;
-            if (!slice[0].compute(ma::shape(a)[0], &start, &stop, &step, &slicelength))
-                throw py::error_already_set();
-
-            std::cout << start << " " << stop << " " << step <<'\n';
-
-            return 0;
-
+            return getItem(a, key);
         });
 
+        bindTransfer<T>(pyclass);
+
         return pyclass;
     }
 } // maw
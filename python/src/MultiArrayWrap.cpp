@@ -10,7 +10,18 @@ template<typename T>
 using MeContainer = ma::container::Container<T>;
 
 template<typename T>
-using MeMArray = ma::MArray<T>;
+using MeMArray = ma::MSharedArray<T>;
+
+struct MArrayBinder
+{
+    template<typename T>
+    static void call(py::module& m)
+    {
+        maw::bindArray<T, MeMArray>(m, "MArray")
+        .def(py::init<int>())
+        .def(py::init<ma::VectRange>());
+    }
+};
 
 PYBIND11_MODULE(MultiArrayWrap, m) {
   m.doc() = "MultiArray interface module";
@@ -19,7 +30,5 @@ PYBIND11_MODULE(MultiArrayWrap, m) {
   // maw::bindArray<int, MeContainer>(m, "Container")
   // .def(py::init<int>());
 
-  maw::bindArray<int, MeMArray>(m, "MArray")
-  .def(py::init<int>())
-  .def(py::init<ma::VectRange>());
+  apply<MArrayBinder, maw::MATypeList>(m);
 }
\ No newline at end of file
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <ma>
+
+using namespace ma;
+
+namespace
+{
+    // Sum of the block (i, j) of fi x fj elements, on element positions
+    template<typename R, typename View>
+    R blockSum(const View & v, SizeT cols, SizeT i, SizeT j, SizeT fi, SizeT fj)
+    {
+        R s(0);
+        for(SizeT a(0); a < fi; ++a)
+            for(SizeT b(0); b < fj; ++b)
+                s += R(v.val((i * fi + a) * cols + j * fj + b));
+        return s;
+    }
+
+    TEST(binTest, Bin2x2)
+    {
+        MArray<float> a({6, 8});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = i;
+
+        auto s = bin(a, {2, 2});
+        EXPECT_EQ(s.shape(), VectRange({3, 4}));
+        EXPECT_EQ(s.val(0), 0.f + 1.f + 8.f + 9.f);
+        EXPECT_EQ(s.val(11), 38.f + 39.f + 46.f + 47.f);
+
+        auto m = bin(a, {2, 2}, BinMode::mean);
+        EXPECT_EQ(m.val(0), 4.5f);
+        EXPECT_EQ(m.val(5), (18.f + 19.f + 26.f + 27.f) / 4.f);
+
+        // Incomplete blocks are dropped, factors differ per axis
+        auto r = bin(a, {4, 3});
+        EXPECT_EQ(r.shape(), VectRange({1, 2}));
+        for(SizeT j(0); j < 2; ++j)
+            EXPECT_EQ(r.val(j), (blockSum<float>(a, 8, 0, j, 4, 3)));
+    }
+
+    TEST(binTest, StridedSourceAndThreads)
+    {
+        parallel::ThreadPool pool(3);
+
+        MArray<std::uint16_t> frame({64, 96});
+        for(SizeT i(0); i < frame.size(); ++i) frame.val(i) = std::uint16_t(i * 37 % 60000);
+
+        // Every other column of a sub frame
+        auto view = frame.at(L(4, 60), L(1, 97, 2));
+        MArray<std::uint16_t> dense({56, 48});
+        dense.setMem(view);
+
+        // Sums overflow 16 bits : wider destination
+        MArray<std::uint32_t> sums({14, 12});
+        algorithm::bin(pool, view, {4, 4}, sums.ptr());
+
+        for(SizeT i(0); i < 14; ++i)
+            for(SizeT j(0); j < 12; ++j)
+                EXPECT_EQ(sums.val(i * 12 + j), (blockSum<std::uint32_t>(dense, 48, i, j, 4, 4)));
+
+        // Same type : saturated sums, rounded means
+        auto s = bin(pool, view, {4, 4});
+        auto m = bin(view, {4, 4}, BinMode::mean);
+        for(SizeT i(0); i < s.size(); ++i)
+        {
+            EXPECT_EQ(s.val(i), std::uint16_t(std::min<std::uint32_t>(sums.val(i), std::numeric_limits<std::uint16_t>::max())));
+            EXPECT_NEAR(m.val(i), sums.val(i) / 16., 0.5);
+        }
+    }
+
+    TEST(binTest, ThreeDimensions)
+    {
+        MArray<int> a({4, 6, 5});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = int(i % 11) - 5;
+
+        auto b = bin(a, {2, 3, 1});
+        auto m = bin(a, {2, 3, 1}, BinMode::mean);
+        EXPECT_EQ(b.shape(), VectRange({2, 2, 5}));
+
+        for(SizeT i(0); i < 2; ++i)
+            for(SizeT j(0); j < 2; ++j)
+                for(SizeT k(0); k < 5; ++k)
+                {
+                    int s(0);
+                    for(SizeT x(0); x < 2; ++x)
+                        for(SizeT y(0); y < 3; ++y)
+                            s += a.val(((i * 2 + x) * 6 + j * 3 + y) * 5 + k);
+                    EXPECT_EQ(b.val((i * 2 + j) * 5 + k), s);
+                    EXPECT_EQ(m.val((i * 2 + j) * 5 + k), int(std::floor(s / 6. + 0.5)));
+                }
+
+        EXPECT_THROW(bin(a, {2, 2}), std::length_error);
+        EXPECT_THROW(bin(a, {2, 0, 1}), std::invalid_argument);
+        EXPECT_THROW(algorithm::binShape(a, {2, 3, -1}), std::invalid_argument);
+    }
+}
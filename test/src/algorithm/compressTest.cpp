@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <ma>
+
+using namespace ma;
+
+namespace
+{
+    TEST(compressTest, CompressFloat)
+    {
+        MArray<float> a({5, 13});
+        MArray<std::uint8_t> mask({5, 13});
+
+        std::vector<float> expected;
+        for(SizeT i(0); i < a.size(); ++i)
+        {
+            a.val(i) = i;
+            mask.val(i) = (i % 3 == 0 || i % 7 == 1);
+            if(mask.val(i)) expected.push_back(i);
+        }
+
+        auto c = compress(a, mask);
+
+        ASSERT_EQ(c.size(), SizeT(expected.size()));
+        for(SizeT i(0); i < c.size(); ++i)
+            EXPECT_EQ(c.val(i), expected[i]);
+    }
+
+    TEST(compressTest, CompressStridedView)
+    {
+        MArray<double> a({4, 6});
+        MArray<bool> mask({4, 3}, false);
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = i;
+
+        mask.val(0) = true;
+        mask.val(4) = true;
+        mask.val(11) = true;
+
+        auto c = compress(a.at(all, L(0, 6, 2)), mask);
+
+        ASSERT_EQ(c.size(), 3);
+        EXPECT_EQ(c.val(0), 0);
+        EXPECT_EQ(c.val(1), 8);
+        EXPECT_EQ(c.val(2), 22);
+    }
+
+    TEST(compressTest, MaskedAssignAndFill)
+    {
+        MArray<std::int64_t> a(21, std::int64_t(0));
+        MArray<std::uint8_t> mask(21, std::uint8_t(0));
+
+        std::vector<std::int64_t> values;
+        for(SizeT i(0); i < a.size(); i += 2)
+        {
+            mask.val(i) = 1;
+            values.push_back(100 + i);
+        }
+
+        EXPECT_EQ(algorithm::maskedAssign(a, mask, values.data()), SizeT(values.size()));
+
+        for(SizeT i(0); i < a.size(); ++i)
+            EXPECT_EQ(a.val(i), (i % 2 == 0) ? 100 + i : 0);
+
+        algorithm::maskedFill(a, mask, -1);
+
+        for(SizeT i(0); i < a.size(); ++i)
+            EXPECT_EQ(a.val(i), (i % 2 == 0) ? -1 : 0);
+    }
+}
@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <ma>
+
+using namespace ma;
+
+namespace
+{
+    TEST(convertCopyTest, SaturateCast)
+    {
+        using algorithm::saturateCast;
+
+        EXPECT_EQ(saturateCast<std::uint8_t>(-3.f), 0);
+        EXPECT_EQ(saturateCast<std::uint8_t>(255.6f), 255);
+        EXPECT_EQ(saturateCast<std::uint8_t>(2.5f), 2);
+        EXPECT_EQ(saturateCast<std::uint8_t>(3.5f), 4);
+        EXPECT_EQ(saturateCast<std::uint8_t>(std::numeric_limits<float>::quiet_NaN()), 0);
+        EXPECT_EQ(saturateCast<std::int16_t>(1e10f), 32767);
+        EXPECT_EQ(saturateCast<std::uint8_t>(300), 255);
+        EXPECT_EQ(saturateCast<std::uint8_t>(-1), 0);
+        EXPECT_EQ(saturateCast<std::int8_t>(std::uint32_t(200)), 127);
+        EXPECT_EQ(saturateCast<std::uint16_t>(std::uint8_t(200)), 200);
+        EXPECT_EQ(saturateCast<double>(7), 7.);
+    }
+
+    TEST(convertCopyTest, ContiguousUint16ToFloat)
+    {
+        MArray<std::uint16_t> raw({5, 13});
+        for(SizeT i(0); i < raw.size(); ++i) raw.val(i) = std::uint16_t(i * 1000);
+
+        MArray<float> frame({5, 13});
+        frame.setMem(raw);
+
+        for(SizeT i(0); i < raw.size(); ++i)
+            EXPECT_EQ(frame.val(i), float(raw.val(i)));
+    }
+
+    TEST(convertCopyTest, StridedInt32ToDouble)
+    {
+        MArray<std::int32_t> src({6, 8});
+        for(SizeT i(0); i < src.size(); ++i) src.val(i) = std::int32_t(i) - 20;
+
+        MArray<double> dst({6, 4}, 0.);
+        src.at(L(0, 6), L(0, 8, 2)).copyTo(dst);
+
+        for(SizeT i(0); i < 6; ++i)
+            for(SizeT j(0); j < 4; ++j)
+                EXPECT_EQ(dst.val(i * 4 + j), double(src.val(i * 8 + j * 2)));
+    }
+
+    TEST(convertCopyTest, FloatToUint8Saturates)
+    {
+        // Long enough for the vector loop and a tail
+        std::vector<float> values(75);
+        for(SizeT i(0); i < SizeT(values.size()); ++i)
+            values[i] = float(i) * 7.5f - 100.f;
+        values[40] = std::numeric_limits<float>::quiet_NaN();
+        values[41] = 1e20f;
+
+        std::vector<std::uint8_t> bytes(values.size());
+        algorithm::convertCopy(bytes.data(), values.data(), values.size());
+
+        for(SizeT i(0); i < SizeT(values.size()); ++i)
+            EXPECT_EQ(bytes[i], algorithm::saturateCast<std::uint8_t>(values[i]));
+
+        EXPECT_EQ(bytes[40], 0);
+        EXPECT_EQ(bytes[41], 255);
+        EXPECT_EQ(bytes[0], 0);
+    }
+
+    TEST(convertCopyTest, RoundTrips)
+    {
+        std::vector<float> values(37);
+        for(SizeT i(0); i < SizeT(values.size()); ++i)
+            values[i] = float(i) * 2000.25f - 35000.f;
+
+        std::vector<std::int16_t> s16(values.size());
+        std::vector<std::uint16_t> u16(values.size());
+        std::vector<double> d(values.size());
+        std::vector<float> back(values.size());
+
+        algorithm::convertCopy(s16.data(), values.data(), values.size());
+        algorithm::convertCopy(u16.data(), values.data(), values.size());
+        algorithm::convertCopy(d.data(), values.data(), values.size());
+        algorithm::convertCopy(back.data(), d.data(), d.size());
+
+        for(SizeT i(0); i < SizeT(values.size()); ++i)
+        {
+            EXPECT_EQ(s16[i], algorithm::saturateCast<std::int16_t>(values[i]));
+            EXPECT_EQ(u16[i], algorithm::saturateCast<std::uint16_t>(values[i]));
+            EXPECT_EQ(back[i], values[i]);
+        }
+    }
+}
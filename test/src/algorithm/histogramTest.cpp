@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include <ma>
+
+using namespace ma;
+
+namespace
+{
+    TEST(histogramTest, FloatBins)
+    {
+        MArray<float> a({2, 5});
+        a.setMem({0.f, 0.5f, 1.f, 2.5f, 3.99f, 4.f, -1.f, 7.f, std::nanf(""), 1.5f});
+
+        auto h = histogram(a, 4, 0., 4.);
+
+        // 4 falls in the last bin, -1, 7 and NaN are ignored
+        EXPECT_EQ(h.size(), 4);
+        EXPECT_EQ(h.val(0), 2);
+        EXPECT_EQ(h.val(1), 2);
+        EXPECT_EQ(h.val(2), 1);
+        EXPECT_EQ(h.val(3), 2);
+    }
+
+    TEST(histogramTest, ThreadsAndStridedView)
+    {
+        parallel::ThreadPool pool(3);
+
+        MArray<std::uint16_t> frame({600, 700});
+        std::mt19937 gen(1);
+        std::uniform_int_distribution<int> dist(0, 4095);
+        for(SizeT i(0); i < frame.size(); ++i) frame.val(i) = std::uint16_t(dist(gen));
+
+        // Large enough to be split between the threads
+        auto view = frame.at(L(10, 590), L(1, 700, 3));
+
+        std::vector<SizeT> unit(4096, 0), wide(10, 0);
+        for(SizeT i(0); i < view.size(); ++i)
+        {
+            ++unit[view.val(i)];
+            ++wide[ma::min(SizeT(view.val(i) / 409.6), SizeT(9))];
+        }
+
+        // Unit bins, indexed directly
+        auto h = histogram(pool, view, 4096, 0., 4096.);
+        for(SizeT i(0); i < 4096; ++i)
+            ASSERT_EQ(h.val(i), unit[i]);
+
+        auto w = histogram(pool, view, 10, 0., 4096.);
+        for(SizeT i(0); i < 10; ++i)
+            EXPECT_EQ(w.val(i), wide[i]);
+
+        auto single = histogram(view, 10, 0., 4096.);
+        for(SizeT i(0); i < 10; ++i)
+            EXPECT_EQ(single.val(i), wide[i]);
+    }
+
+    TEST(histogramTest, ExactQuantiles)
+    {
+        MArray<double> a({4, 6});
+        std::vector<double> sorted;
+        for(SizeT i(0); i < a.size(); ++i)
+        {
+            a.val(i) = double((i * 7) % 24) * 1.5;
+            sorted.push_back(a.val(i));
+        }
+        std::sort(sorted.begin(), sorted.end());
+
+        EXPECT_EQ(median(a), (sorted[11] + sorted[12]) / 2);
+        EXPECT_EQ(quantile(a, 0.), sorted[0]);
+        EXPECT_EQ(quantile(a, 1.), sorted[23]);
+
+        // Several quantiles in any order, interpolated between order statistics
+        auto q = quantiles(a, {0.9, 0.1, 0.5});
+        EXPECT_DOUBLE_EQ(q[0], sorted[20] + 0.7 * (sorted[21] - sorted[20]));
+        EXPECT_DOUBLE_EQ(q[1], sorted[2] + 0.3 * (sorted[3] - sorted[2]));
+        EXPECT_DOUBLE_EQ(q[2], median(a));
+
+        // Strided view, NaN ignored
+        auto col = a.at(all, 2);
+        col.val(1) = std::nan("");
+        EXPECT_EQ(median(col), 14 * 1.5);
+
+        MArray<float> nan({3}, std::nanf(""));
+        EXPECT_TRUE(std::isnan(median(nan)));
+    }
+
+    TEST(histogramTest, CountedQuantiles)
+    {
+        // Small integers are counted, the result must match the selection on int
+        MArray<short> a({50, 40});
+        MArray<int> b({50, 40});
+        for(SizeT i(0); i < a.size(); ++i)
+            b.val(i) = a.val(i) = short(int((i * 7919) % 3001) - 1500);
+
+        std::vector<double> qs{0.75, 0., 0.25, 0.5, 0.999, 1.};
+        auto qa = quantiles(a, qs), qb = quantiles(b, qs);
+        for(SizeT i(0); i < SizeT(qs.size()); ++i)
+            EXPECT_DOUBLE_EQ(qa[i], qb[i]) << "q " << qs[i];
+
+        auto col = a.at(all, 3);
+        EXPECT_DOUBLE_EQ(median(col), median(b.at(all, 3)));
+
+        MArray<unsigned char> c({5}, (unsigned char)200);
+        c.val(0) = 0; c.val(4) = 255;
+        EXPECT_EQ(median(c), 200.);
+        EXPECT_EQ(quantile(c, 1.), 255.);
+        EXPECT_EQ(quantile(c, 0.125), 100.);
+
+        // Repeated and adjacent quantiles interpolated between the same order statistics
+        MArray<short> d({4});
+        d.setMem({short(0), short(10), short(20), short(30)});
+
+        auto qd = quantiles(d, {0.5, 0.5, 0.4, 0.45, 0.});
+        EXPECT_DOUBLE_EQ(qd[0], 15.);
+        EXPECT_DOUBLE_EQ(qd[1], 15.);
+        EXPECT_DOUBLE_EQ(qd[2], 12.);
+        EXPECT_DOUBLE_EQ(qd[3], 13.5);
+        EXPECT_DOUBLE_EQ(qd[4], 0.);
+    }
+
+    TEST(histogramTest, ApproximateQuantile)
+    {
+        MArray<float> a({10000});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = float(i) / 100.f;
+
+        auto h = histogram(a, 1000, 0., 100.);
+
+        for(double q : {0.01, 0.25, 0.5, 0.99})
+            EXPECT_NEAR(algorithm::histogramQuantile(h.ptr(), 1000, 0., 100., q), quantile(a, q), 0.1);
+    }
+}
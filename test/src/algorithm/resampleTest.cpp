@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include <ma>
+
+using namespace ma;
+
+namespace
+{
+    template<typename T>
+    MArray<T> ramp(SizeT rows, SizeT cols)
+    {
+        MArray<T> a({rows, cols});
+        for(SizeT i(0); i < rows; ++i)
+            for(SizeT j(0); j < cols; ++j)
+                a.val(i * cols + j) = T(2 * i + 3 * j);
+        return a;
+    }
+
+    TEST(resampleTest, IntegerTranslation)
+    {
+        MArray<int> a({5, 6});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = int(i * 7 % 23);
+
+        for(auto interpolation : {Interpolation::linear, Interpolation::cubic})
+        {
+            auto same = translate(a, 0., 0., interpolation);
+            for(SizeT i(0); i < a.size(); ++i)
+                EXPECT_EQ(same.val(i), a.val(i));
+
+            // Edges are repeated
+            auto moved = translate(a, 1., -2., interpolation);
+            for(SizeT i(0); i < 5; ++i)
+                for(SizeT j(0); j < 6; ++j)
+                {
+                    SizeT si(i == 0 ? 0 : i - 1), sj(ma::min(j + 2, SizeT(5)));
+                    EXPECT_EQ(moved.val(i * 6 + j), a.val(si * 6 + sj));
+                }
+        }
+    }
+
+    TEST(resampleTest, SubPixelRamp)
+    {
+        auto a = ramp<double>(12, 15);
+
+        // Both kernels reproduce a linear function away from the edges
+        for(auto interpolation : {Interpolation::linear, Interpolation::cubic})
+        {
+            auto moved = translate(a, 0.25, -0.5, interpolation);
+            for(SizeT i(2); i < 10; ++i)
+                for(SizeT j(2); j < 12; ++j)
+                    EXPECT_NEAR(moved.val(i * 15 + j), 2 * (i - 0.25) + 3 * (j + 0.5), 1e-12);
+
+            // Twice larger, element centers aligned
+            auto up = resample(a, {24, 30}, interpolation);
+            EXPECT_EQ(up.shape(), VectRange({24, 30}));
+            for(SizeT i(4); i < 20; ++i)
+                for(SizeT j(4); j < 26; ++j)
+                    EXPECT_NEAR(up.val(i * 30 + j), 2 * (i * 0.5 - 0.25) + 3 * (j * 0.5 - 0.25), 1e-12);
+        }
+    }
+
+    TEST(resampleTest, StridedSourceAndThreads)
+    {
+        parallel::ThreadPool pool(3);
+
+        MArray<float> big({40, 70});
+        for(SizeT i(0); i < big.size(); ++i) big.val(i) = float(i % 97) * 0.5f;
+
+        auto view = big.at(L(3, 37), L(1, 69, 2));
+        MArray<float> dense({34, 34});
+        dense.setMem(view);
+
+        algorithm::AxisMap rows(algorithm::fitAxis(34, 50)), cols{0.7, 1.3};
+
+        MArray<float> expected({50, 41}), res({50, 41});
+        algorithm::resample(dense, rows, cols, 50, 41, expected.ptr(), Interpolation::cubic);
+        algorithm::resample(pool, view, rows, cols, 50, 41, res.ptr(), Interpolation::cubic);
+
+        for(SizeT i(0); i < res.size(); ++i)
+            EXPECT_EQ(res.val(i), expected.val(i));
+
+        // Translation, same weights along the rows
+        auto movedDense = translate(dense, -1.6, 2.3, Interpolation::cubic);
+        auto moved = translate(view, -1.6, 2.3, Interpolation::cubic);
+        for(SizeT i(0); i < moved.size(); ++i)
+            EXPECT_EQ(moved.val(i), movedDense.val(i));
+    }
+
+    TEST(resampleTest, SaturatedOvershoot)
+    {
+        // Cubic overshoot on a step edge saturates instead of wrapping
+        MArray<std::uint8_t> step({4, 8});
+        for(SizeT i(0); i < step.size(); ++i) step.val(i) = (i % 8 < 4) ? 0 : 255;
+
+        auto moved = translate(step, 0., 0.5, Interpolation::cubic);
+        for(SizeT i(0); i < 4; ++i)
+        {
+            EXPECT_EQ(moved.val(i * 8 + 3), 0);
+            EXPECT_EQ(moved.val(i * 8 + 4), 128);
+            EXPECT_EQ(moved.val(i * 8 + 5), 255);
+        }
+
+        EXPECT_THROW(resample(step, {4, 4, 1}), std::length_error);
+    }
+}
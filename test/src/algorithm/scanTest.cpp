@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include <ma>
+
+using namespace ma;
+
+namespace
+{
+    TEST(scanTest, Operations)
+    {
+        MArray<int> a({6});
+        a.setMem({3, -1, 4, 1, -5, 9});
+
+        auto sum = scan(a, algorithm::ScanSum());
+        auto excl = scan(a, algorithm::ScanSum(), 0, ScanMode::exclusive);
+        auto prod = scan(a, algorithm::ScanProd());
+        auto max = scan(a, algorithm::ScanMax());
+        auto min = scan(a, algorithm::ScanMin(), 0, ScanMode::exclusive);
+
+        std::vector<int> eSum({3, 2, 6, 7, 2, 11}), eExcl({0, 3, 2, 6, 7, 2});
+        std::vector<int> eProd({3, -3, -12, -12, 60, 540}), eMax({3, 3, 4, 4, 4, 9});
+        std::vector<int> eMin({std::numeric_limits<int>::max(), 3, -1, -1, -1, -5});
+
+        for(SizeT i(0); i < 6; ++i)
+        {
+            EXPECT_EQ(sum.val(i), eSum[i]);
+            EXPECT_EQ(excl.val(i), eExcl[i]);
+            EXPECT_EQ(prod.val(i), eProd[i]);
+            EXPECT_EQ(max.val(i), eMax[i]);
+            EXPECT_EQ(min.val(i), eMin[i]);
+        }
+    }
+
+    TEST(scanTest, LongLineBlocks)
+    {
+        parallel::ThreadPool pool(3);
+
+        // Strided line long enough to be cut between the threads
+        MArray<std::int64_t> a({2, 200003});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = std::int64_t(i % 13) - 6;
+
+        auto line = a.at(1, all);
+
+        for(auto mode : {ScanMode::inclusive, ScanMode::exclusive})
+        {
+            auto res = scan(pool, line, algorithm::ScanSum(), 0, mode);
+
+            std::int64_t s(0);
+            for(SizeT i(0); i < 200003; ++i)
+            {
+                if(mode == ScanMode::inclusive) s += line.val(i);
+                ASSERT_EQ(res.val(i), s) << i;
+                if(mode == ScanMode::exclusive) s += line.val(i);
+            }
+        }
+    }
+
+    TEST(scanTest, OuterAxisLanes)
+    {
+        parallel::ThreadPool pool(2);
+
+        // More lanes than one task takes
+        MArray<double> a({7, 2500});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = double(i % 17);
+
+        auto res = scan(pool, a, algorithm::ScanMax(), 0);
+        for(SizeT j(0); j < 2500; ++j)
+        {
+            double m(a.val(j));
+            for(SizeT i(0); i < 7; ++i)
+            {
+                m = std::max(m, a.val(i * 2500 + j));
+                EXPECT_EQ(res.val(i * 2500 + j), m);
+            }
+        }
+
+        // Middle axis of a strided view, exclusive
+        MArray<int> b({3, 5, 8});
+        for(SizeT i(0); i < b.size(); ++i) b.val(i) = int(i % 7);
+
+        auto v = b.at(all, all, L(0, 8, 2));
+        auto c = scan(v, algorithm::ScanSum(), 1, ScanMode::exclusive);
+
+        for(SizeT i(0); i < 3; ++i)
+            for(SizeT l(0); l < 4; ++l)
+            {
+                int s(0);
+                for(SizeT k(0); k < 5; ++k)
+                {
+                    EXPECT_EQ(c.val((i * 5 + k) * 4 + l), s);
+                    s += b.val((i * 5 + k) * 8 + 2 * l);
+                }
+            }
+    }
+
+    TEST(scanTest, IntegralImageInPlace)
+    {
+        MArray<std::uint8_t> frame({33, 47});
+        for(SizeT i(0); i < frame.size(); ++i) frame.val(i) = std::uint8_t(i * 31 % 256);
+
+        // Rows scanned to a wider type, then columns in place
+        MArray<std::uint32_t> integral(frame.shape());
+        algorithm::scan(frame, integral.ptr(), algorithm::ScanSum(), 1);
+        algorithm::scan(integral, integral.ptr(), algorithm::ScanSum(), 0);
+
+        for(SizeT i(0); i < 33; i += 4)
+            for(SizeT j(0); j < 47; j += 3)
+            {
+                std::uint32_t s(0);
+                for(SizeT y(0); y <= i; ++y)
+                    for(SizeT x(0); x <= j; ++x)
+                        s += frame.val(y * 47 + x);
+                EXPECT_EQ(integral.val(i * 47 + j), s);
+            }
+    }
+}
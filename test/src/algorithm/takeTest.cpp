@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <ma>
+
+using namespace ma;
+
+namespace
+{
+    TEST(takeTest, TakeLastAxis)
+    {
+        MArray<double> a({3, 10});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = i;
+
+        auto t = take(a, {9, 0, 3, 3, 7}, 1);
+
+        EXPECT_EQ(t.shape(), VectRange({3, 5}));
+        EXPECT_EQ(t.val(0), 9);
+        EXPECT_EQ(t.val(3), 3);
+        EXPECT_EQ(t.val(5), 19);
+        EXPECT_EQ(t.val(14), 27);
+    }
+
+    TEST(takeTest, TakeRowsOfView)
+    {
+        MArray<int> a({6, 4});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = i;
+
+        // Strided rows : every other column
+        auto v = a.at(all, L(0, 4, 2));
+        auto t = take(v, {5, 1}, 0);
+
+        EXPECT_EQ(t.shape(), VectRange({2, 2}));
+        EXPECT_EQ(t.val(0), 20);
+        EXPECT_EQ(t.val(1), 22);
+        EXPECT_EQ(t.val(2), 4);
+        EXPECT_EQ(t.val(3), 6);
+
+        // Strided gather along the first axis
+        auto c = take(a.at(all, 1), {0, 2, 4}, 0);
+        EXPECT_EQ(c.val(2), 17);
+    }
+
+    TEST(takeTest, PutRows)
+    {
+        MArray<int> a({4, 3}, 0);
+
+        std::vector<int> rows({1, 2, 3, 4, 5, 6});
+        algorithm::put(a, {3, 0}, rows.data(), 0);
+
+        EXPECT_EQ(a.val(9), 1);
+        EXPECT_EQ(a.val(11), 3);
+        EXPECT_EQ(a.val(0), 4);
+        EXPECT_EQ(a.val(4), 0);
+
+        auto col = a.at(all, 1);
+        std::vector<int> values({7, 8});
+        algorithm::put(col, {1, 2}, values.data(), 0);
+
+        EXPECT_EQ(a.val(4), 7);
+        EXPECT_EQ(a.val(7), 8);
+    }
+}
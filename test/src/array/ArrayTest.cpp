@@ -121,5 +121,140 @@ namespace
         EXPECT_TRUE(true);
 
     }
-}
 
+    TEST(ArrayTest, FArray)
+    {
+        FArray<int, 2, 3, 4> a;
+
+        EXPECT_NE(a.ptr(), nullptr);
+        EXPECT_EQ(a.size(), 24);
+        EXPECT_EQ(a.baseSize(), 24);
+        EXPECT_TRUE(a.contiguous());
+
+        a.setMem(42);
+
+        auto v = a[1];
+
+        static_assert(is_same<decltype(v), FArrayView<int, 3, 4>>::value, "Static extents are kept");
+
+        EXPECT_EQ(v.ptr(), a.ptr() + 12);
+        EXPECT_EQ(v.val(3), 42);
+    }
+
+    TEST(ArrayTest, FArrayWithDynamicExtent)
+    {
+        FArray<int, dynamicExtent, 4> a({3, 4}, 1);
+
+        EXPECT_EQ(a.size(), 12);
+
+        auto v = a.at(L(1, 3), L(0, 4, 2));
+
+        EXPECT_EQ(v.size(), 4);
+        EXPECT_EQ(v.ptr(), a.ptr() + 4);
+
+        v.setMem(5);
+
+        EXPECT_EQ(a.val(4), 5);
+        EXPECT_EQ(a.val(5), 1);
+        EXPECT_EQ(a.val(6), 5);
+    }
+
+    TEST(ArrayTest, MSharedSubArray)
+    {
+        MSharedArray<int> a({3, 4}, 0);
+
+        auto sub = a.subArray(L(1, 3), L(0, 4, 2));
+
+        static_assert(is_same<decltype(sub), MSharedArray<int>>::value, "Sub array keeps the container type");
+
+        EXPECT_EQ(sub.ptr(), a.ptr() + 4);
+        EXPECT_EQ(sub.shape(), VectRange({2, 2}));
+        EXPECT_EQ(sub.strides(), VectRange({4, 2}));
+
+        sub.setMem(7);
+
+        EXPECT_EQ(a.val(4), 7);
+        EXPECT_EQ(a.val(5), 0);
+        EXPECT_EQ(a.val(10), 7);
+    }
+
+    TEST(ArrayTest, MSharedSubArrayAt)
+    {
+        MSharedArray<int> a({3, 4}, 0);
+
+        auto sub = a.subArrayAt(1, 2).subArrayAt(0, L(1, 3));
+
+        EXPECT_EQ(sub.shape(), VectRange({2}));
+        EXPECT_EQ(sub.ptr(), a.ptr() + 6);
+        EXPECT_EQ(sub.strides(), VectRange({4}));
+    }
+
+    TEST(ArrayTest, MArrayReshape)
+    {
+        MArray<int> a({4, 3, 2});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = i;
+
+        auto r = a.reshape({4, 6});
+        EXPECT_EQ(r.ptr(), a.ptr());
+        EXPECT_EQ(r.val(7), 7);
+
+        auto flat = a.flatten();
+        EXPECT_EQ(flat.shape(), VectRange({24}));
+        EXPECT_EQ(flat.val(23), 23);
+
+        // A column can't be seen as one dimension without copy
+        auto col = a.at(all, 1, all);
+        EXPECT_THROW(col.reshape({8}), std::invalid_argument);
+
+        auto c = reshapeCopy(col, {8});
+        EXPECT_EQ(c.shape(), VectRange({8}));
+        EXPECT_EQ(c.val(0), 2);
+        EXPECT_EQ(c.val(2), 8);
+    }
+
+    TEST(ArrayTest, MArrayWindows)
+    {
+        MArray<int> a({4, 5});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = i;
+
+        auto w = a.windows({3, 3});
+        EXPECT_EQ(w.shape(), VectRange({2, 3, 3, 3}));
+
+        // 3x3 box sums without copying patches
+        for(SizeT i(0); i < 2; ++i)
+            for(SizeT j(0); j < 3; ++j)
+            {
+                int sum(0);
+                for(auto e : w[i][j]) sum += e;
+
+                EXPECT_EQ(sum, 9 * ((i + 1) * 5 + (j + 1)));
+            }
+    }
+
+    TEST(ArrayTest, MLocalSharedSubArray)
+    {
+        MLocalSharedArray<int> a({4, 4});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = i;
+
+        auto sub = a.subArray(L(1, 3), 2);
+        a = MLocalSharedArray<int>({1});
+
+        // sub keeps the data alive
+        EXPECT_EQ(sub.val(0), 6);
+        EXPECT_EQ(sub.val(1), 10);
+    }
+
+    TEST(ArrayTest, MArrayZeros)
+    {
+        MArray<float> a({512, 1024}, zeros);
+
+        EXPECT_EQ(a.size(), 512 * 1024);
+        EXPECT_EQ(a.val(0), 0.f);
+        EXPECT_EQ(a.val(a.size() - 1), 0.f);
+
+        MSharedArray<int> b({4, 4}, zeros);
+        auto sub = b.subArray(L(1, 3), L(1, 3));
+        for(SizeT i(0); i < sub.size(); ++i)
+            EXPECT_EQ(sub.val(i), 0);
+    }
+}
@@ -5,6 +5,7 @@
 #include <ma_api/dimension/MultiShape.h>
 #include <ma_api/range/LinearRange.h>
 #include <ma_api/function.h>
+#include <ma_api/algorithm/parallelCopy.h>
 
 using namespace ma;
 using namespace ma::array;
@@ -149,5 +150,151 @@ namespace
         EXPECT_EQ(a.val(2), 1);
         EXPECT_EQ(a.val(4), 1);
     }
-}
 
+    // Sets the parallel copy threshold for the scope of a test
+    struct ThresholdGuard
+    {
+        SizeT saved;
+
+        explicit ThresholdGuard(SizeT threshold) : saved(algorithm::parallelCopyThreshold())
+        {
+            algorithm::parallelCopyThreshold() = threshold;
+        }
+
+        ~ThresholdGuard()
+        {
+            algorithm::parallelCopyThreshold() = saved;
+        }
+    };
+
+    TEST(ArrayViewTest, ParallelCopy)
+    {
+        ThresholdGuard guard(0);
+        parallel::ThreadPool pool3(2), pool4(3);
+
+        std::vector<int> v1(100), v2(100, 0), v3(50, 0);
+        for(SizeT i(0); i < SizeT(v1.size()); ++i) v1[i] = i;
+
+        ArrayView<int, DefaultAlloc<int>, MultiShape<LinearRange>> a1({10, 10}, v1.data());
+        ArrayView<int, DefaultAlloc<int>, MultiShape<LinearRange>> a2({10, 10}, v2.data());
+        ArrayView<int, DefaultAlloc<int>, MultiShape<LinearRange>> a3({10, 5}, v3.data());
+
+        algorithm::multiCopyParallel<int>(pool3, a2, a1);
+        EXPECT_EQ(v1, v2);
+
+        // Strided source, blocks of 5 elements split between threads
+        algorithm::multiCopyParallel<int>(pool4, a3, a1.at(all, L(0, 5)));
+        for(SizeT i(0); i < 10; ++i)
+            for(SizeT j(0); j < 5; ++j)
+                EXPECT_EQ(a3.val(i * 5 + j), int(i * 10 + j));
+
+        auto right = a2.at(all, L(5, 10));
+        algorithm::multiCopyParallel<int>(pool4, right, 7);
+        for(SizeT i(0); i < 10; ++i)
+            for(SizeT j(0); j < 10; ++j)
+                EXPECT_EQ(v2[i * 10 + j], (j < 5) ? int(i * 10 + j) : 7);
+    }
+
+    TEST(ArrayViewTest, StreamingCopy)
+    {
+        SizeT threshold(algorithm::streamingThreshold());
+        algorithm::streamingThreshold() = 0;
+
+        // Odd sizes and offsets to go through the unaligned head and tail
+        std::vector<int> v1(1001), v2(1003, 0), v3(500, 0);
+        for(SizeT i(0); i < SizeT(v1.size()); ++i) v1[i] = i;
+
+        ArrayView<int, DefaultAlloc<int>, MultiShape<LinearRange>> a1({7, 143}, v1.data());
+        ArrayView<int, DefaultAlloc<int>, MultiShape<LinearRange>> a2({7, 143}, v2.data() + 1);
+        ArrayView<int, DefaultAlloc<int>, MultiShape<LinearRange>> a3({7, 70}, v3.data());
+
+        a2.setMem(a1);
+        for(SizeT i(0); i < 1001; ++i)
+            EXPECT_EQ(v2[i + 1], int(i));
+        EXPECT_EQ(v2[0], 0);
+        EXPECT_EQ(v2[1002], 0);
+
+        a3.setMem(a1.at(all, L(1, 71)));
+        for(SizeT i(0); i < 7; ++i)
+            for(SizeT j(0); j < 70; ++j)
+                EXPECT_EQ(a3.val(i * 70 + j), int(i * 143 + j + 1));
+
+        auto right = a2.at(all, L(3, 143));
+        right.setMem(-5);
+        for(SizeT i(0); i < 7; ++i)
+            for(SizeT j(0); j < 143; ++j)
+                EXPECT_EQ(v2[1 + i * 143 + j], (j < 3) ? int(i * 143 + j) : -5);
+
+        std::vector<char> bytes(77, 'a');
+        algorithm::streamFill(bytes.data() + 3, 'b', 70);
+        algorithm::streamFence();
+        EXPECT_EQ(std::string(bytes.begin(), bytes.end()), std::string(3, 'a') + std::string(70, 'b') + std::string(4, 'a'));
+
+        algorithm::streamingThreshold() = threshold;
+    }
+
+    TEST(ArrayViewTest, OverlappingCopy)
+    {
+        using View = ArrayView<int, DefaultAlloc<int>, MultiShape<LinearRange>>;
+
+        std::vector<int> v(100);
+        auto reset = [&]{ for(SizeT i(0); i < 100; ++i) v[i] = i; };
+
+        View a({10, 10}, v.data());
+
+        // Rows moved down then up, contiguous
+        reset();
+        a.at(L(0, 9), all).copyTo(a.at(L(1, 10), all));
+        for(SizeT i(10); i < 100; ++i) EXPECT_EQ(v[i], int(i - 10));
+
+        reset();
+        a.at(L(1, 10), all).copyTo(a.at(L(0, 9), all));
+        for(SizeT i(0); i < 90; ++i) EXPECT_EQ(v[i], int(i + 10));
+
+        // Columns moved right, blocks of 9 elements copied from the last
+        reset();
+        a.at(all, L(0, 9)).copyTo(a.at(all, L(1, 10)));
+        for(SizeT i(0); i < 10; ++i)
+            for(SizeT j(1); j < 10; ++j)
+                EXPECT_EQ(v[i * 10 + j], int(i * 10 + j - 1));
+
+        // Pointer destination
+        reset();
+        a.at(L(2, 10), all).copyTo(v.data() + 10);
+        for(SizeT i(10); i < 90; ++i) EXPECT_EQ(v[i], int(i + 10));
+
+        // Different layouts go through a temporary : in place transpose
+        reset();
+        View square({4, 4}, v.data());
+        ArrayView<int, DefaultAlloc<int>, StridedShape> transposed(StridedShape({4, 4}, {1, 4}), v.data());
+        square.setMem(transposed);
+        for(SizeT i(0); i < 4; ++i)
+            for(SizeT j(0); j < 4; ++j)
+                EXPECT_EQ(v[i * 4 + j], int(j * 4 + i));
+    }
+
+    TEST(ArrayViewTest, BroadcastRow)
+    {
+        std::vector<int> row({1, 2, 3}), frame(6, 0);
+        ArrayView<int, DefaultAlloc<int>, MultiShape<LinearRange>> r(3, row.data());
+        ArrayView<int, DefaultAlloc<int>, MultiShape<LinearRange>> f({2, 3}, frame.data());
+
+        auto b = r.broadcastTo({2, 3});
+
+        EXPECT_EQ(b.size(), 6);
+        EXPECT_EQ(std::distance(b.begin(), b.end()), 6);
+
+        f.setMem(b);
+        EXPECT_EQ(frame, std::vector<int>({1, 2, 3, 1, 2, 3}));
+
+        // Broadcast column
+        ArrayView<int, DefaultAlloc<int>, StridedShape> col(StridedShape({2, 1}, {1, 1}), row.data());
+        col.broadcastTo({2, 3}).copyTo(f);
+        EXPECT_EQ(frame, std::vector<int>({1, 1, 1, 2, 2, 2}));
+
+        SizeT n(0);
+        for(auto v : b)
+            EXPECT_EQ(v, row[n++ % 3]);
+        EXPECT_EQ(n, 6);
+    }
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <ma>
+
+using namespace ma;
+
+namespace
+{
+    TEST(RingArrayTest, PushAndLatest)
+    {
+        RingArray<int> r(4, {2, 3});
+
+        EXPECT_EQ(r.history(), 4);
+        EXPECT_EQ(r.filled(), 0);
+
+        for(int f(0); f < 6; ++f)
+            r.push(std::vector<int>(6, f));
+
+        EXPECT_EQ(r.filled(), 4);
+
+        // Frames 2 to 5 are kept, 4 and 5 wrapped to the first slots
+        auto last3 = r.latest(3);
+        EXPECT_EQ(last3.shape(), VectRange({3, 2, 3}));
+        EXPECT_FALSE(last3.contiguous());
+
+        EXPECT_EQ(last3.val(0), 3);
+        EXPECT_EQ(last3.val(6), 4);
+        EXPECT_EQ(last3.val(17), 5);
+
+        EXPECT_EQ(last3[2].val(0), 5);
+
+        auto last2 = r.latest().at(L(2, 4));
+        EXPECT_EQ(last2.shape(), VectRange({2, 2, 3}));
+        EXPECT_EQ(last2.val(0), 4);
+        EXPECT_EQ(last2.val(6), 5);
+
+        MArray<int> copy({3, 2, 3});
+        copy.setMem(last3);
+        for(SizeT i(0); i < copy.size(); ++i)
+            EXPECT_EQ(copy.val(i), 3 + i / 6);
+    }
+
+    TEST(RingArrayTest, Segments)
+    {
+        RingArray<float> r(5, {4});
+
+        for(int f(0); f < 7; ++f)
+            r.push(std::vector<float>(4, f));
+
+        auto seg = r.segments(4);
+
+        EXPECT_EQ(seg.first.shape(), VectRange({2, 4}));
+        EXPECT_EQ(seg.second.shape(), VectRange({2, 4}));
+        EXPECT_TRUE(seg.first.contiguous());
+
+        EXPECT_EQ(seg.first.val(0), 3);
+        EXPECT_EQ(seg.second.val(0), 5);
+        EXPECT_EQ(seg.second.val(7), 6);
+
+        auto inOrder = r.segments(2);
+        EXPECT_EQ(inOrder.first.shape(), VectRange({2, 4}));
+        EXPECT_EQ(inOrder.second.size(), 0);
+
+        // Frames that don't wrap : the second segment is empty but usable
+        RingArray<float> fresh(5, {4});
+        fresh.push(std::vector<float>(4, 1.f));
+        fresh.push(std::vector<float>(4, 2.f));
+
+        auto unwrapped = fresh.segments(2);
+        EXPECT_EQ(unwrapped.first.shape(), VectRange({2, 4}));
+        EXPECT_EQ(unwrapped.second.size(), 0);
+        EXPECT_EQ(unwrapped.second.ptr(), unwrapped.first.ptr());
+
+        const RingArray<float> & constFresh(fresh);
+        EXPECT_EQ(constFresh.segments(2).second.ptr(), unwrapped.first.ptr());
+
+        // Read only segments of a const ring
+        const RingArray<float> & c(r);
+        auto constSeg = c.segments(4);
+
+        static_assert(std::is_same<decltype(constSeg.first.val(0)), const float &>::value, "const ring gives const views");
+        EXPECT_EQ(constSeg.first.ptr(), seg.first.ptr());
+        EXPECT_EQ(constSeg.second.val(7), 6);
+    }
+}
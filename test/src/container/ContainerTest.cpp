@@ -49,5 +49,29 @@ namespace
         EXPECT_EQ(c2.size(), size);
         EXPECT_EQ(c2.data(), ptr);
     }
-}
 
+    TEST(ContainerTest, ZerosConstructor)
+    {
+        // Large enough to come from fresh pages
+        SizeT size = SizeT(1) << 24;
+
+        Container<double> c1(size, zeros);
+
+        EXPECT_EQ(c1.size(), size);
+        EXPECT_EQ(c1.data()[0], 0.);
+        EXPECT_EQ(c1.data()[size / 2], 0.);
+        EXPECT_EQ(c1.data()[size - 1], 0.);
+
+        // Moves keep track of the calloc block
+        Container<double> c2(std::move(c1));
+        c2 = Container<double>(10, zeros);
+        c2 = Container<double>(10);
+
+        // Types not allowed to use calloc are filled with their default value
+        struct Point { int x, y; };
+
+        Container<Point> c3(3, zeros);
+        EXPECT_EQ(c3.data()[2].x, 0);
+        EXPECT_EQ(c3.data()[2].y, 0);
+    }
+}
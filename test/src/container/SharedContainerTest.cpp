@@ -49,5 +49,29 @@ namespace
         EXPECT_EQ(c2.size(), size);
         EXPECT_EQ(c2.data(), ptr);
     }
-}
 
+    TEST(SharedContainerTest, LocalRefCount)
+    {
+        using LocalContainer = SharedContainer<int, DefaultAlloc<int>, Container<int>, LocalRefCount>;
+
+        LocalContainer c1(100);
+        auto ptr = c1.data();
+
+        EXPECT_EQ(c1.use_count(), 1);
+
+        {
+            LocalContainer c2(c1);
+            LocalContainer c3(std::move(c2));
+
+            EXPECT_EQ(c3.data(), ptr);
+            EXPECT_EQ(c1.use_count(), 2);
+
+            c3 = LocalContainer(10);
+            EXPECT_EQ(c1.use_count(), 1);
+            EXPECT_EQ(c3.size(), 10);
+        }
+
+        EXPECT_EQ(c1.use_count(), 1);
+        EXPECT_EQ(c1.size(), 100);
+    }
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <ma_api/dimension/StaticShape.h>
+
+using namespace ma;
+using namespace ma::range;
+using namespace ma::dimension;
+
+namespace
+{
+    TEST(StaticShapeTest, SimpleStaticShape)
+    {
+        constexpr StaticShape<8, 64, 64> s;
+
+        static_assert(s.size() == 8 * 64 * 64, "Size must be a constant expression");
+        static_assert(s.at(5) == 5, "Offset must be a constant expression");
+        static_assert(s.contiguous(), "Static shape is always contiguous");
+
+        EXPECT_EQ(s.ndim(), 3);
+        EXPECT_EQ(s.step(), s.size());
+        EXPECT_EQ(s.shape(), VectRange({8, 64, 64}));
+    }
+
+    TEST(StaticShapeTest, MixedStaticShape)
+    {
+        StaticShape<dynamicExtent, 4, dynamicExtent> s({3, 4, 5});
+
+        EXPECT_FALSE(s.isStatic);
+        EXPECT_EQ(s.dynamicRank, 2);
+        EXPECT_EQ(s.size(), 60);
+        EXPECT_EQ(s.extent(0), 3);
+        EXPECT_EQ(s.extent(1), 4);
+        EXPECT_EQ(s.extent(2), 5);
+    }
+
+    TEST(StaticShapeTest, CloseStaticShape)
+    {
+        StaticShape<dynamicExtent, 4, 5> s({3, 4, 5});
+
+        auto c = s.closeAt(2);
+
+        static_assert(is_same<decltype(c), StaticShape<4, 5>>::value, "Close keeps remaining extents");
+
+        EXPECT_EQ(c.size(), 20);
+        EXPECT_EQ(c.at(0), 40);
+
+        auto cc = c.closeAt(1);
+
+        EXPECT_EQ(cc.size(), 5);
+        EXPECT_EQ(cc.at(2), 47);
+    }
+
+    TEST(StaticShapeTest, SubStaticShape)
+    {
+        StaticShape<3, 4, 5> s;
+
+        auto sub = s.closeAt(1).subShape(L(1, 3), L(2, 4));
+
+        EXPECT_EQ(sub.size(), 4);
+        EXPECT_EQ(sub.at(0), 20 + 5 + 2);
+        EXPECT_EQ(sub.at(3), 20 + 10 + 3);
+        EXPECT_FALSE(sub.contiguous());
+    }
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+
+#include <ma_api/dimension/StridedShape.h>
+#include <ma_api/dimension/MultiShape.h>
+
+using namespace ma;
+using namespace ma::range;
+using namespace ma::dimension;
+
+namespace
+{
+    TEST(StridedShapeTest, EmptyStridedShape)
+    {
+        StridedShape s;
+
+        EXPECT_EQ(s.size(), 0);
+        EXPECT_EQ(s.ndim(), 1);
+        EXPECT_EQ(s.at(0), 0);
+
+        // Any empty dimension leaves the offset alone
+        StridedShape e({0, 4}, {4, 1}, 7);
+        EXPECT_EQ(e.size(), 0);
+        EXPECT_EQ(e.at(0), 7);
+    }
+
+    TEST(StridedShapeTest, DenseStridedShape)
+    {
+        StridedShape s({3, 4, 5});
+
+        EXPECT_TRUE(s.contiguous());
+        EXPECT_EQ(s.size(), 60);
+        EXPECT_EQ(s.strides(), VectRange({20, 5, 1}));
+        EXPECT_EQ(s.at(27), 27);
+    }
+
+    TEST(StridedShapeTest, TransposedStridedShape)
+    {
+        StridedShape s(VectRange{4, 3}, VectRange{1, 4});
+
+        EXPECT_FALSE(s.contiguous());
+        EXPECT_EQ(s.step(), 1);
+        EXPECT_EQ(s.at(1), 4);
+        EXPECT_EQ(s.at(3), 1);
+    }
+
+    TEST(StridedShapeTest, SubStridedShape)
+    {
+        StridedShape s({3, 4, 5});
+
+        auto sub = s.subShape(1, L(0, 4, 2));
+
+        EXPECT_EQ(sub.ndim(), 2);
+        EXPECT_EQ(sub.size(), 10);
+        EXPECT_EQ(sub.step(), 5);
+        EXPECT_EQ(sub.at(0), 20);
+        EXPECT_EQ(sub.at(5), 30);
+
+        auto c = sub.closeAt(1);
+
+        EXPECT_EQ(c.ndim(), 1);
+        EXPECT_EQ(c.at(2), 32);
+    }
+
+    TEST(StridedShapeTest, FromMultiShape)
+    {
+        MultiShape<LinearRange> m(VectRange{3, 4, 5});
+
+        auto sub = m.subShape(L(1, 3), all, L(0, 5, 2));
+
+        EXPECT_EQ(sub.strides(), VectRange({20, 5, 2}));
+
+        auto s = stridedShape(sub);
+
+        EXPECT_EQ(s.size(), sub.size());
+
+        for(SizeT pos(0); pos < s.size(); ++pos)
+            EXPECT_EQ(s.at(pos), sub.at(pos));
+    }
+
+    TEST(StridedShapeTest, BroadcastTo)
+    {
+        StridedShape s(VectRange{3, 1});
+
+        auto b = s.broadcastTo({2, 3, 4});
+
+        EXPECT_EQ(b.shape(), VectRange({2, 3, 4}));
+        EXPECT_EQ(b.strides(), VectRange({0, 1, 0}));
+        EXPECT_EQ(b.size(), 24);
+        EXPECT_EQ(b.step(), 1);
+
+        EXPECT_EQ(b.at(0), 0);
+        EXPECT_EQ(b.at(3), 0);
+        EXPECT_EQ(b.at(4), 1);
+        EXPECT_EQ(b.at(12 + 9), 2);
+
+        EXPECT_THROW(s.broadcastTo({2, 4}), std::length_error);
+        EXPECT_THROW(s.broadcastTo({4}), std::length_error);
+    }
+
+    TEST(StridedShapeTest, Reshape)
+    {
+        StridedShape s(VectRange{10, 8, 8});
+
+        auto r = s.reshape({10, 64});
+        EXPECT_EQ(r.strides(), VectRange({64, 1}));
+
+        auto f = s.reshape({80, 8});
+        EXPECT_EQ(f.strides(), VectRange({8, 1}));
+
+        // Every other row : rows stay contiguous, planes don't merge with rows
+        auto sub = s.subShape(all, L(0, 8, 2), all);
+        auto rs = sub.reshape({40, 8});
+        EXPECT_EQ(rs.strides(), VectRange({16, 1}));
+
+        for(SizeT pos(0); pos < rs.size(); ++pos)
+            EXPECT_EQ(rs.at(pos), sub.at(pos));
+
+        EXPECT_FALSE(sub.reshapeable({10, 32}));
+        EXPECT_THROW(sub.reshape({10, 32}), std::invalid_argument);
+        EXPECT_THROW(s.reshape({10, 8}), std::length_error);
+
+        auto ones = s.reshape({1, 10, 1, 64, 1});
+        for(SizeT pos(0); pos < ones.size(); ++pos)
+            EXPECT_EQ(ones.at(pos), pos);
+    }
+
+    TEST(StridedShapeTest, Windows)
+    {
+        StridedShape s(VectRange{5, 6});
+
+        auto w = s.windows({3, 2}, 2);
+
+        EXPECT_EQ(w.shape(), VectRange({2, 3, 3, 2}));
+        EXPECT_EQ(w.strides(), VectRange({12, 2, 6, 1}));
+
+        // Window (1, 2) starts at row 2, column 4
+        auto win = w.closeAt(1).closeAt(2);
+        EXPECT_EQ(win.at(0), 16);
+        EXPECT_EQ(win.at(5), 29);
+
+        EXPECT_THROW(s.windows({6, 2}), std::length_error);
+    }
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <ma>
+#include <ma_api/interop/mdspan.h>
+
+#ifndef MA_HAS_MDSPAN
+#error "mdspanTest needs <experimental/mdspan> on the include path"
+#endif
+
+using namespace ma;
+using namespace ma::interop;
+
+namespace
+{
+    TEST(MdspanTest, ContiguousToMdspan)
+    {
+        MArray<int> a({2, 3}, {0, 1, 2, 3, 4, 5});
+
+        auto span = toMdspan<2, md::layout_right>(a);
+
+        EXPECT_EQ(span.data_handle(), a.ptr());
+        EXPECT_EQ(span(1, 2), 5);
+    }
+
+    TEST(MdspanTest, StridedToMdspan)
+    {
+        MArray<int> a({3, 4}, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+
+        auto v = a.at(L(1, 3), L(0, 4, 2));
+
+        auto span = toMdspan<2>(v);
+
+        EXPECT_EQ(span.data_handle(), a.ptr() + 4);
+        EXPECT_EQ(span(1, 1), 10);
+
+        EXPECT_THROW((toMdspan<2, md::layout_right>(v)), std::invalid_argument);
+        EXPECT_THROW((toMdspan<3>(v)), std::length_error);
+
+        // Broadcast dimensions have a 0 stride, which layout_stride forbids
+        auto b = v.broadcastTo({3, 2, 2});
+        EXPECT_THROW((toMdspan<3>(b)), std::invalid_argument);
+    }
+
+    TEST(MdspanTest, FromMdspan)
+    {
+        std::vector<int> d({0, 1, 2, 3, 4, 5});
+
+        md::mdspan<int, Extents<2>> right(d.data(), md::layout_right::mapping<Extents<2>>(Extents<2>(std::array<std::size_t, 2>{{2, 3}})));
+
+        auto v = fromMdspan(right);
+
+        EXPECT_EQ(v.shape(), VectRange({2, 3}));
+        EXPECT_EQ(v.val(4), 4);
+
+        md::mdspan<int, Extents<2>, md::layout_stride> transposed(d.data(), md::layout_stride::mapping<Extents<2>>(
+            Extents<2>(std::array<std::size_t, 2>{{3, 2}}), std::array<std::size_t, 2>{{1, 3}}));
+
+        auto t = fromMdspan(transposed);
+
+        EXPECT_EQ(t.val(1), 3);
+        EXPECT_EQ(t.val(2), 1);
+    }
+}
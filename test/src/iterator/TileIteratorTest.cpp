@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <ma>
+
+using namespace ma;
+
+namespace
+{
+    TEST(TileIteratorTest, RowMajorTilesWithEdges)
+    {
+        MArray<int> a({5, 7}, 0);
+
+        auto t = tiles(a, {2, 3});
+
+        EXPECT_EQ(t.size(), 9);
+        EXPECT_EQ(t.counts(), VectRange({3, 3}));
+
+        EXPECT_EQ(t.at(0).shape(), VectRange({2, 3}));
+        EXPECT_EQ(t.at(2).shape(), VectRange({2, 1}));
+        EXPECT_EQ(t.at(8).shape(), VectRange({1, 1}));
+
+        // Every element belongs to exactly one tile
+        int id(0);
+        for(auto tile : t)
+        {
+            ++id;
+            for(auto & e : tile) e += id;
+        }
+
+        EXPECT_EQ(a.val(0), 1);
+        EXPECT_EQ(a.val(3), 2);
+        EXPECT_EQ(a.val(6), 3);
+        EXPECT_EQ(a.val(4 * 7 + 6), 9);
+
+        for(SizeT i(0); i < a.size(); ++i)
+            EXPECT_GT(a.val(i), 0);
+    }
+
+    TEST(TileIteratorTest, MortonOrder)
+    {
+        EXPECT_EQ(iterator::TileRange<MArray<int>>::mortonOrder({2, 2}), VectRange({0, 1, 2, 3}));
+        EXPECT_EQ(iterator::TileRange<MArray<int>>::mortonOrder({4, 4}),
+            VectRange({0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15}));
+
+        // Rectangular grid : each cell visited once
+        VectRange order(iterator::TileRange<MArray<int>>::mortonOrder({3, 5}));
+        std::sort(order.begin(), order.end());
+        for(SizeT i(0); i < 15; ++i)
+            EXPECT_EQ(order[i], i);
+    }
+
+    TEST(TileIteratorTest, MortonTilesOfView)
+    {
+        MArray<int> a({8, 16});
+        for(SizeT i(0); i < a.size(); ++i) a.val(i) = int(i);
+
+        // Every other column : 8 x 8 elements, 4 x 4 tiles
+        auto v = a.at(L(0, 8), L(0, 16, 2));
+
+        auto t = tiles(v, {2, 2}, TileOrder::morton);
+
+        EXPECT_EQ(t.size(), 16);
+
+        // Tile k is the cell morton[k] of the grid, read through the strides of v
+        VectRange morton({0, 1, 4, 5, 2, 3, 6, 7, 8, 9, 12, 13, 10, 11, 14, 15});
+        for(SizeT k(0); k < 16; ++k)
+        {
+            SizeT r(morton[k] / 4), c(morton[k] % 4);
+            auto tile = t.at(k);
+
+            for(SizeT i(0); i < 2; ++i)
+                for(SizeT j(0); j < 2; ++j)
+                    EXPECT_EQ(tile.val(i * 2 + j), a.val((2 * r + i) * 16 + 2 * (2 * c + j))) << "tile " << k;
+        }
+
+        EXPECT_EQ(t.at(2).ptr(), &a.val(2 * 16));
+        EXPECT_EQ(t.at(4).ptr(), &a.val(2 * 4));
+    }
+}
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <stdexcept>
+
+#include <ma>
+#include <ma_api/linalg/batched.h>
+
+#include "randomFill.h"
+
+using namespace ma;
+using ma::test::randomize;
+
+namespace
+{
+    // c[s] = a[s] * b[s] on element positions, a single matrix when count is 1
+    template<typename T, typename A, typename B>
+    std::vector<T> reference(const A & a, SizeT aCount, const B & b, SizeT bCount, SizeT count, SizeT m, SizeT k, SizeT n)
+    {
+        std::vector<T> c(count * m * n, T(0));
+
+        for(SizeT s(0); s < count; ++s)
+        {
+            SizeT sa(aCount == 1 ? 0 : s), sb(bCount == 1 ? 0 : s);
+
+            for(SizeT i(0); i < m; ++i)
+                for(SizeT j(0); j < n; ++j)
+                    for(SizeT p(0); p < k; ++p)
+                        c[(s * m + i) * n + j] += a.val((sa * m + i) * k + p) * b.val((sb * k + p) * n + j);
+        }
+
+        return c;
+    }
+
+    TEST(batchedTest, MatmulSizes)
+    {
+        parallel::ThreadPool pool(3);
+
+        for(SizeT n : {2, 3, 4, 5, 8})
+        {
+            MArray<double> a({SizeT(1000), n, n}), b({SizeT(1000), n, n}), c({SizeT(1000), n, n});
+            randomize(a, 1); randomize(b, 2);
+
+            linalg::batchedMatmul(pool, a, b, c);
+
+            auto expected = reference<double>(a, 1000, b, 1000, 1000, n, n, n);
+            for(SizeT i(0); i < c.size(); ++i)
+                ASSERT_EQ(c.val(i), expected[i]) << "size " << n;
+        }
+
+        // Not square
+        MArray<float> a({10, 2, 3}), b({10, 3, 4}), c({10, 2, 4});
+        randomize(a, 3); randomize(b, 4);
+
+        linalg::batchedMatmul(a, b, c);
+
+        auto expected = reference<float>(a, 10, b, 10, 10, 2, 3, 4);
+        for(SizeT i(0); i < c.size(); ++i)
+            EXPECT_EQ(c.val(i), expected[i]);
+    }
+
+    TEST(batchedTest, MatmulStridedAndBroadcast)
+    {
+        MArray<float> big({50, 6, 6}), m({4, 4}), c({50, 4, 4}), d({50, 8, 4}, 0.f);
+        randomize(big, 5); randomize(m, 6);
+
+        // Sub matrices of a larger stack, result every other row
+        auto a = big.at(all, L(1, 5), L(2, 6));
+        auto dt = d.at(all, L(0, 8, 2), all);
+
+        MArray<float> dense({50, 4, 4});
+        dense.setMem(a);
+
+        linalg::batchedMatmul(a, m, dt);
+
+        auto expected = reference<float>(dense, 50, m, 1, 50, 4, 4, 4);
+        for(SizeT i(0); i < dt.size(); ++i)
+            EXPECT_EQ(dt.val(i), expected[i]);
+        for(SizeT i(0); i < 50 * 4; ++i)
+            EXPECT_EQ(d.val(i * 8 + 4), 0.f);
+
+        // Same matrix on the left of every element
+        linalg::batchedMatmul(m, dense, c);
+
+        auto expectedLeft = reference<float>(m, 1, dense, 50, 50, 4, 4, 4);
+        for(SizeT i(0); i < c.size(); ++i)
+            EXPECT_EQ(c.val(i), expectedLeft[i]);
+    }
+
+    TEST(batchedTest, Matvec)
+    {
+        // One transform applied to many points
+        MArray<float> t({4, 4}), points({777, 4}), out({777, 4});
+        randomize(t, 7); randomize(points, 8);
+
+        linalg::batchedMatvec(t, points, out);
+
+        for(SizeT s(0); s < 777; ++s)
+            for(SizeT i(0); i < 4; ++i)
+            {
+                float v(0);
+                for(SizeT j(0); j < 4; ++j) v += t.val(i * 4 + j) * points.val(s * 4 + j);
+                EXPECT_EQ(out.val(s * 4 + i), v);
+            }
+
+        // One matrix per vector, strided output
+        MArray<double> a({30, 3, 3}), x({30, 3}), y({30, 6}, 1.);
+        randomize(a, 9); randomize(x, 10);
+
+        linalg::batchedMatvec(a, x, y.at(all, L(0, 6, 2)));
+
+        for(SizeT s(0); s < 30; ++s)
+            for(SizeT i(0); i < 3; ++i)
+            {
+                double v(0);
+                for(SizeT j(0); j < 3; ++j) v += a.val((s * 3 + i) * 3 + j) * x.val(s * 3 + j);
+                EXPECT_EQ(y.val(s * 6 + 2 * i), v);
+                EXPECT_EQ(y.val(s * 6 + 2 * i + 1), 1.);
+            }
+    }
+
+    // Residual of a * x = b for each element and column
+    template<typename A, typename X, typename B>
+    double residual(const A & a, const X & x, const B & b, SizeT count, SizeT n, SizeT r)
+    {
+        double worst(0);
+
+        for(SizeT s(0); s < count; ++s)
+            for(SizeT i(0); i < n; ++i)
+                for(SizeT c(0); c < r; ++c)
+                {
+                    double v(0);
+                    for(SizeT j(0); j < n; ++j) v += a.val((s * n + i) * n + j) * x.val((s * n + j) * r + c);
+                    worst = std::max(worst, std::abs(v - b.val((s * n + i) * r + c)));
+                }
+
+        return worst;
+    }
+
+    TEST(batchedTest, Solve)
+    {
+        for(SizeT n : {2, 4, 6, 8})
+        {
+            MArray<double> a({SizeT(200), n, n}), b({SizeT(200), n}), x({SizeT(200), n});
+            randomize(a, 11); randomize(b, 12);
+
+            // Keep the systems well conditioned
+            for(SizeT s(0); s < 200; ++s)
+                for(SizeT i(0); i < n; ++i)
+                    a.val((s * n + i) * n + i) += 5. * double(n);
+
+            EXPECT_EQ(linalg::batchedSolve(a, b, x), 0);
+            EXPECT_LT(residual(a, x, b, 200, n, 1), 1e-10) << "size " << n;
+        }
+
+        // Split between the threads of a pool
+        {
+            parallel::ThreadPool pool(3);
+
+            MArray<double> a({1000, 3, 3}), b({1000, 3}), x({1000, 3});
+            randomize(a, 14); randomize(b, 15);
+            for(SizeT s(0); s < 1000; ++s)
+                for(SizeT i(0); i < 3; ++i)
+                    a.val((s * 3 + i) * 3 + i) += 15.;
+
+            EXPECT_EQ(linalg::batchedSolve(pool, a, b, x), 0);
+            EXPECT_LT(residual(a, x, b, 1000, 3, 1), 1e-10);
+        }
+
+        // Several right hand sides, pivoting needed
+        MArray<float> a({20, 3, 3}), b({20, 3, 2}), x({20, 3, 2});
+        randomize(b, 13);
+        for(SizeT s(0); s < 20; ++s)
+            a.at(s).setMem({0.f, 2.f, 1.f, 1.f, 0.f, 3.f, 4.f, 1.f, 0.f});
+
+        EXPECT_EQ(linalg::batchedSolve(a, b, x), 0);
+        EXPECT_LT(residual(a, x, b, 20, 3, 2), 1e-4);
+
+        // Singular systems are counted and give NaN
+        a.at(3).setMem({1.f, 2.f, 3.f, 2.f, 4.f, 6.f, 0.f, 1.f, 1.f});
+        EXPECT_EQ(linalg::batchedSolve(a, b, x), 1);
+        EXPECT_TRUE(std::isnan(x.val(3 * 6)));
+        EXPECT_FALSE(std::isnan(x.val(4 * 6)));
+    }
+
+    TEST(batchedTest, ThrowSizeMismatch)
+    {
+        MArray<float> a({5, 4, 4}), b({6, 4, 4}), c({5, 4, 3}), x({5, 3});
+
+        EXPECT_THROW(linalg::batchedMatmul(a, b, a), std::length_error);
+        EXPECT_THROW(linalg::batchedMatmul(a, a, c), std::length_error);
+        EXPECT_THROW(linalg::batchedMatvec(a, x, x), std::length_error);
+        EXPECT_THROW(linalg::batchedSolve(c, x, x), std::length_error);
+    }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include <ma>
+#include <ma_api/linalg/gemm.h>
+
+#include "randomFill.h"
+
+using namespace ma;
+using ma::test::randomize;
+
+namespace
+{
+    // c(i, j) = sum a(i, k) * b(k, j), on element positions of views of any layout
+    template<typename T, typename A, typename B>
+    std::vector<T> reference(const A & a, const B & b)
+    {
+        SizeT m(a.shape()[0]), k(a.shape()[1]), n(b.shape()[1]);
+        std::vector<T> c(m * n, T(0));
+
+        for(SizeT i(0); i < m; ++i)
+            for(SizeT j(0); j < n; ++j)
+                for(SizeT p(0); p < k; ++p)
+                    c[i * n + j] += a.val(i * k + p) * b.val(p * n + j);
+
+        return c;
+    }
+
+    TEST(gemmTest, FloatEdges)
+    {
+        parallel::ThreadPool pool(3);
+
+        // Sizes not multiple of the blocks, k larger than one panel
+        MArray<float> a({70, 300}), b({300, 45}), c({70, 45});
+        randomize(a, 1); randomize(b, 2);
+
+        linalg::gemm(pool, 1.f, a, b, 0.f, c);
+
+        auto expected = reference<float>(a, b);
+        for(SizeT i(0); i < c.size(); ++i)
+            EXPECT_EQ(c.val(i), expected[i]);
+
+        // alpha and beta
+        linalg::gemm(pool, 2.f, a, b, -1.f, c);
+        for(SizeT i(0); i < c.size(); ++i)
+            EXPECT_EQ(c.val(i), expected[i]);
+    }
+
+    TEST(gemmTest, StridedViews)
+    {
+        MArray<double> big({40, 50}), b({20, 13}), c({30, 26}, 0.);
+        randomize(big, 3); randomize(b, 4);
+
+        // Sub matrix of a larger one, result written every other column
+        auto a = big.at(L(5, 25), L(10, 30));
+        auto left = big.at(L(0, 30), L(0, 20));
+        auto ct = c.at(L(0, 30), L(0, 26, 2));
+
+        linalg::gemm(1., left, b, 0., ct);
+
+        auto expected = reference<double>(left, b);
+        for(SizeT i(0); i < ct.size(); ++i)
+            EXPECT_EQ(ct.val(i), expected[i]);
+        for(SizeT i(0); i < 30; ++i)
+            EXPECT_EQ(c.val(i * 26 + 1), 0.);
+
+        // Transposed operand
+        MArray<double> d({20, 20});
+        array::ArrayView<double, DefaultAlloc<double>, dimension::StridedShape> at(dimension::StridedShape({20, 20}, {1, 50}, 0), a.ptr());
+        linalg::gemm(1., at, a, 0., d);
+
+        auto expectedT = reference<double>(at, a);
+        for(SizeT i(0); i < d.size(); ++i)
+            EXPECT_EQ(d.val(i), expectedT[i]);
+    }
+
+    TEST(gemmTest, GenericType)
+    {
+        MArray<int> a({9, 7}), b({7, 11}), c({9, 11});
+        randomize(a, 5); randomize(b, 6);
+
+        linalg::gemm(1, a, b, 0, c);
+
+        auto expected = reference<int>(a, b);
+        for(SizeT i(0); i < c.size(); ++i)
+            EXPECT_EQ(c.val(i), expected[i]);
+    }
+
+    TEST(gemmTest, Gemv)
+    {
+        parallel::ThreadPool pool(2);
+
+        MArray<float> a({101, 67}), x({67}), y({101});
+        randomize(a, 7); randomize(x, 8);
+
+        MArray<float> xm({67, 1});
+        xm.setMem(x);
+        auto expected = reference<float>(a, xm);
+
+        linalg::gemv(pool, 1.f, a, x, 0.f, y);
+        for(SizeT i(0); i < y.size(); ++i)
+            EXPECT_EQ(y.val(i), expected[i]);
+
+        // Column major matrix : transposed view of a (67, 101) array
+        MArray<float> t({67, 101});
+        for(SizeT i(0); i < 101; ++i)
+            for(SizeT j(0); j < 67; ++j)
+                t.val(j * 101 + i) = a.val(i * 67 + j);
+
+        array::ArrayView<float, DefaultAlloc<float>, dimension::StridedShape> tt(dimension::StridedShape({101, 67}, {1, 101}, 0), t.ptr());
+
+        linalg::gemv(pool, 1.f, tt, x, 0.f, y);
+        for(SizeT i(0); i < y.size(); ++i)
+            EXPECT_EQ(y.val(i), expected[i]);
+
+        // Without pool, on the calling thread
+        y.setMem(0.f);
+        linalg::gemv(1.f, tt, x, 0.f, y);
+        for(SizeT i(0); i < y.size(); ++i)
+            EXPECT_EQ(y.val(i), expected[i]);
+
+        // No unit stride, strided vectors
+        MArray<float> wide({101, 134}), x2({134}), y2({202}, 1.f);
+        wide.at(all, L(0, 134, 2)).setMem(a);
+        x2.at(L(0, 134, 2)).setMem(x);
+
+        auto y2s = y2.at(L(0, 202, 2));
+        linalg::gemv(pool, 1.f, wide.at(all, L(0, 134, 2)), x2.at(L(0, 134, 2)), 2.f, y2s);
+        for(SizeT i(0); i < 101; ++i)
+        {
+            EXPECT_EQ(y2.val(2 * i), expected[i] + 2.f);
+            EXPECT_EQ(y2.val(2 * i + 1), 1.f);
+        }
+    }
+
+    TEST(gemmTest, ThrowSizeMismatch)
+    {
+        MArray<float> a({4, 5}), b({4, 5}), c({4, 5}), x({4});
+
+        EXPECT_THROW(linalg::gemm(1.f, a, b, 0.f, c), std::length_error);
+        EXPECT_THROW(linalg::gemv(1.f, a, x, 0.f, x), std::length_error);
+    }
+}
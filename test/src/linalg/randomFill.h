@@ -0,0 +1,29 @@
+#ifndef MA_TEST_LINALG_RANDOM_FILL_H
+#define MA_TEST_LINALG_RANDOM_FILL_H
+
+#include <random>
+#include <type_traits>
+
+#include <ma_api/type.h>
+
+namespace ma
+{
+    namespace test
+    {
+        /**
+         * Small integers in [-4, 4] : products and sums stay exact in float,
+         * so results can be compared for equality with a reference
+         **/
+        template<typename View>
+        void randomize(View && view, unsigned seed)
+        {
+            std::mt19937 gen(seed);
+            std::uniform_int_distribution<int> dist(-4, 4);
+
+            for(SizeT i(0); i < view.size(); ++i)
+                view.val(i) = typename std::decay<View>::type::value_type(dist(gen));
+        }
+    }
+}
+
+#endif //MA_TEST_LINALG_RANDOM_FILL_H
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <ma>
+#include <ma_api/parallel/async.h>
+
+using namespace ma;
+
+namespace
+{
+    TEST(AsyncTest, CopyToAsync)
+    {
+        MArray<int> src({64, 32});
+        for(SizeT i(0); i < src.size(); ++i) src.val(i) = i;
+
+        std::vector<int> dst(src.size(), 0);
+
+        auto done = parallel::copyToAsync(src, dst.data());
+        done.get();
+
+        EXPECT_TRUE(done.ready());
+        for(SizeT i(0); i < SizeT(dst.size()); ++i)
+            EXPECT_EQ(dst[i], int(i));
+    }
+
+    TEST(AsyncTest, SetMemAsyncStrided)
+    {
+        MArray<int> staging({8, 8}, 0);
+        MArray<int> frame({8, 4});
+        for(SizeT i(0); i < frame.size(); ++i) frame.val(i) = i + 1;
+
+        auto half = staging.at(L(0, 8), L(0, 8, 2));
+
+        parallel::setMemAsync(half, frame).get();
+        parallel::setMemAsync(staging.at(L(0, 8), L(1, 9, 2)), -1).get();
+
+        for(SizeT i(0); i < 8; ++i)
+            for(SizeT j(0); j < 4; ++j)
+            {
+                EXPECT_EQ(staging.val(i * 8 + j * 2), frame.val(i * 4 + j));
+                EXPECT_EQ(staging.val(i * 8 + j * 2 + 1), -1);
+            }
+    }
+
+    TEST(AsyncTest, ThenRunsInOrder)
+    {
+        parallel::AsyncQueue queue;
+
+        MArray<int> a({1000}, 1), b({1000}, 0);
+        std::vector<int> c(1000, 0);
+
+        // The arrays are captured as views of their memory, not copied
+        using Captured = decltype(parallel::impl::captureOf(b));
+        static_assert(std::is_base_of<Captured, MArray<int>>::value && !std::is_same<Captured, MArray<int>>::value,
+            "arrays are captured as views");
+
+        auto done = parallel::copyToAsync(a, b, queue).then([&]{ b.copyTo(c.data()); });
+        done.get();
+
+        EXPECT_EQ(c.front(), 1);
+        EXPECT_EQ(c.back(), 1);
+    }
+
+    TEST(AsyncTest, ErrorSkipsContinuation)
+    {
+        parallel::AsyncQueue queue(2);
+        std::atomic<bool> called(false);
+
+        auto failed = queue.submit([]{ throw std::runtime_error("copy failed"); });
+        auto next = failed.then([&]{ called = true; });
+
+        EXPECT_THROW(failed.get(), std::runtime_error);
+        EXPECT_THROW(next.get(), std::runtime_error);
+        EXPECT_FALSE(called);
+
+        // Size mismatch of the copy is reported through the completion
+        MArray<int> a({10}), b({12});
+        EXPECT_THROW(parallel::copyToAsync(a, b, queue).get(), std::length_error);
+    }
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include <ma>
+#include <ma_api/parallel/FrameQueue.h>
+
+using namespace ma;
+
+namespace
+{
+    TEST(FrameQueueTest, RecycleFrames)
+    {
+        parallel::FrameQueue<MSharedArray<int>> q(2, VectRange{4, 4});
+
+        EXPECT_EQ(q.capacity(), 2);
+
+        const int * first(nullptr);
+        EXPECT_TRUE(q.tryPush([&](MSharedArray<int> & f) { f.setMem(1); first = f.ptr(); }));
+        EXPECT_TRUE(q.tryPush([](MSharedArray<int> & f) { f.setMem(2); }));
+
+        // All frames in flight
+        EXPECT_FALSE(q.tryPush([](MSharedArray<int> &) {}));
+
+        EXPECT_TRUE(q.tryConsume([](const MSharedArray<int> & f) { EXPECT_EQ(f.val(15), 1); }));
+
+        // The released buffer is reused
+        EXPECT_TRUE(q.tryPush([&](MSharedArray<int> & f) { EXPECT_EQ(f.ptr(), first); f.setMem(3); }));
+
+        EXPECT_TRUE(q.tryConsume([](const MSharedArray<int> & f) { EXPECT_EQ(f.val(0), 2); }));
+        EXPECT_TRUE(q.tryConsume([](const MSharedArray<int> & f) { EXPECT_EQ(f.val(0), 3); }));
+        EXPECT_FALSE(q.tryConsume([](const MSharedArray<int> &) {}));
+    }
+
+    TEST(FrameQueueTest, ManyProducersConsumers)
+    {
+        const int frameNb(2000);
+        parallel::FrameQueue<MArray<int>> q(4, VectRange{8});
+
+        std::atomic<long> sum(0);
+        std::atomic<int> consumed(0);
+
+        auto produce = [&](int base)
+        {
+            for(int i(0); i < frameNb; ++i)
+                while(!q.tryPush([&](MArray<int> & f) { f.setMem(base + i); }))
+                    std::this_thread::yield();
+        };
+
+        auto consume = [&]
+        {
+            while(consumed < 2 * frameNb)
+                if(!q.tryConsume([&](const MArray<int> & f) { sum += f.val(0) + f.val(7); ++consumed; }))
+                    std::this_thread::yield();
+        };
+
+        std::thread p1(produce, 0), p2(produce, frameNb), c1(consume), c2(consume);
+        p1.join(); p2.join(); c1.join(); c2.join();
+
+        EXPECT_EQ(consumed, 2 * frameNb);
+        EXPECT_EQ(sum, 2L * (2 * frameNb - 1) * (2 * frameNb) / 2);
+    }
+}
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include <ma>
+#include <ma_api/parallel/parallel.h>
+
+using namespace ma;
+
+namespace
+{
+    TEST(ThreadPoolTest, ParallelForCoversRange)
+    {
+        parallel::ThreadPool pool(3);
+
+        std::vector<std::atomic<int>> hits(10007);
+        for(auto & h : hits) h = 0;
+
+        pool.parallelFor(0, hits.size(), 13, [&](SizeT first, SizeT last)
+        {
+            EXPECT_LE(last - first, 13);
+            for(SizeT i(first); i < last; ++i) ++hits[i];
+        });
+
+        for(auto & h : hits)
+            EXPECT_EQ(h, 1);
+    }
+
+    TEST(ThreadPoolTest, ParallelForRethrows)
+    {
+        parallel::ThreadPool pool(2);
+
+        EXPECT_THROW(pool.parallelFor(0, 100, 1, [](SizeT first, SizeT)
+        {
+            if(first == 42) throw std::runtime_error("task failed");
+        }), std::runtime_error);
+
+        // The pool stays usable
+        std::atomic<SizeT> sum(0);
+        pool.parallelFor(0, 100, 7, [&](SizeT first, SizeT last) { sum += last - first; });
+        EXPECT_EQ(sum, 100);
+    }
+
+    TEST(ThreadPoolTest, ForEachStridedView)
+    {
+        parallel::ThreadPool pool(3);
+
+        MArray<int> a({64, 10}, 0);
+        auto v = a.at(all, L(2, 8));
+
+        parallel::forEach(pool, v, [](int & e) { e += 1; }, 16);
+
+        for(SizeT i(0); i < 64; ++i)
+            for(SizeT j(0); j < 10; ++j)
+                EXPECT_EQ(a.val(i * 10 + j), (j >= 2 && j < 8) ? 1 : 0);
+    }
+
+    TEST(ThreadPoolTest, Transform)
+    {
+        parallel::ThreadPool pool(2);
+
+        MArray<float> src(1000), dst(1000);
+        for(SizeT i(0); i < src.size(); ++i) src.val(i) = i;
+
+        parallel::transform(pool, src, dst, [](float e) { return 2 * e + 1; }, 64);
+
+        for(SizeT i(0); i < dst.size(); ++i)
+            EXPECT_EQ(dst.val(i), 2 * i + 1);
+    }
+}